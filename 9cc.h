@@ -4,12 +4,35 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <assert.h>
 #include <errno.h>
 
 typedef struct Type Type;
 typedef struct Member Member;
 typedef struct Initializer Initializer;
+typedef struct Reloc Reloc;
+
+//
+// Arena
+//
+
+// オブジェクトを確保する領域の種類
+// 同じ領域のオブジェクトは、まとめて確保しまとめて解放する
+typedef enum {
+    ARENA_TOKEN,    // トークン
+    ARENA_AST,      // ノード、関数、初期化子など
+    ARENA_TYPE,     // 型、構造体メンバ
+    ARENA_SCOPE,    // 変数、スコープ
+    ARENA_NUM,
+} ArenaKind;
+
+void *arena_alloc(ArenaKind kind, size_t size);
+void arena_reset(ArenaKind kind);
+void arena_reset_all();
+void arena_release_all();
+void arena_report(FILE *fp);
+char *arena_strndup(char *p, int len);
 
 //
 // Tokenizer
@@ -25,16 +48,95 @@ typedef enum {
     TK_EOF,         // 入力の終わり
 } TokenKind;
 
+// 予約語と記号の種類
+// トークナイザで分類しておき、パーサは文字列ではなくこの値で判定する
+typedef enum {
+    RESERVED_NONE,  // 予約語・記号ではない
+    // Keywords
+    KW_RETURN,     // "return"
+    KW_IF,         // "if"
+    KW_ELSE,       // "else"
+    KW_WHILE,      // "while"
+    KW_FOR,        // "for"
+    KW_INT,        // "int"
+    KW_CHAR,       // "char"
+    KW_SIZEOF,     // "sizeof"
+    KW_STRUCT,     // "struct"
+    KW_TYPEDEF,    // "typedef"
+    KW_SHORT,      // "short"
+    KW_LONG,       // "long"
+    KW_VOID,       // "void"
+    KW_BOOL,       // "_Bool"
+    KW_ENUM,       // "enum"
+    KW_STATIC,     // "static"
+    KW_BREAK,      // "break"
+    KW_CONTINUE,   // "continue"
+    KW_GOTO,       // "goto"
+    KW_SWITCH,     // "switch"
+    KW_CASE,       // "case"
+    KW_DEFAULT,    // "default"
+    // Punctuators
+    PT_LPAREN,     // "("
+    PT_RPAREN,     // ")"
+    PT_LBRACE,     // "{"
+    PT_RBRACE,     // "}"
+    PT_LBRACKET,   // "["
+    PT_RBRACKET,   // "]"
+    PT_SEMICOLON,  // ";"
+    PT_COMMA,      // ","
+    PT_DOT,        // "."
+    PT_ARROW,      // "->"
+    PT_QUESTION,   // "?"
+    PT_COLON,      // ":"
+    PT_ASSIGN,     // "="
+    PT_ADD_ASSIGN, // "+="
+    PT_SUB_ASSIGN, // "-="
+    PT_MUL_ASSIGN, // "*="
+    PT_DIV_ASSIGN, // "/="
+    PT_SHL_ASSIGN, // "<<="
+    PT_SHR_ASSIGN, // ">>="
+    PT_PLUS,       // "+"
+    PT_MINUS,      // "-"
+    PT_STAR,       // "*"
+    PT_SLASH,      // "/"
+    PT_AMP,        // "&"
+    PT_PIPE,       // "|"
+    PT_CARET,      // "^"
+    PT_TILDE,      // "~"
+    PT_NOT,        // "!"
+    PT_SHL,        // "<<"
+    PT_SHR,        // ">>"
+    PT_EQ,         // "=="
+    PT_NE,         // "!="
+    PT_LT,         // "<"
+    PT_LE,         // "<="
+    PT_GT,         // ">"
+    PT_GE,         // ">="
+    PT_LOGAND,     // "&&"
+    PT_LOGOR,      // "||"
+    PT_INC,        // "++"
+    PT_DEC,        // "--"
+    RESERVED_NUM,
+} ReservedKind;
+
 typedef struct Token Token;
 struct Token {
     TokenKind kind;     // トークンの型
+    ReservedKind reserved; // kind が TK_RESERVED の場合は予約語・記号の種類
     Token *next;        // 次の入力トークン
     long val;            // kind が TK_NUM の場合はその数値
     char *str;          // トークンの文字列
     int len;            // 文字列長
-
-    char *contents;     // トークンが文字列リテラルの場合、その文字列(NULL 文字を含む)
-    char cont_len;      // トークンが文字列リテラルの場合、その文字列の長さ
+    int line;           // 行番号(1始まり)
+    int col;            // 行の中での位置(1始まり)
+    char *name;         // kind が TK_IDENT の場合は intern された識別子名
+    bool is_kept;       // AST などから参照されているので解放しない
+
+    // トークンが文字列リテラルの場合、その中身と、末尾の NUL 文字を含めた長さ
+    // エスケープのないリテラルの contents は入力を直接指しているので、NUL 終端されていない
+    // 最後の NUL 文字は contents から読まずに 0 として扱う
+    char *contents;
+    int cont_len;
 };
 
 // 変数の型
@@ -50,6 +152,8 @@ struct Var {
 
     // グローバル変数用
     Initializer *initializer;
+    bool is_literal;    // 文字列リテラル
+    bool is_written;    // 書き換えられうる(emit_data が調べる)
 };
 
 // 変数のリスト
@@ -59,23 +163,50 @@ struct VarList {
     Var *var;
 };
 
-extern char *filename;      // ソースコードのファイル名
-extern char *user_input;    // 入力プログラム
-extern Token *token;        // 現在見ているトークン
+extern _Thread_local char *filename;    // ソースコードのファイル名
+extern _Thread_local char *user_input;  // 入力プログラム
+extern _Thread_local Token *token;      // 現在見ているトークン
 
 void error(char *fmt, ...);
 void error_at(char *loc, char *fmt, ...);
 void error_tok(Token *tok, char *fmt, ...);
+void raise_error(char *msg);
+char *catch_error(void (*fn)(void *), void *arg);
+void compile();
 
 bool at_eof();
-Token *peek(char *s);
-Token *consume(char *s);
+Token *peek(ReservedKind kind);
+Token *consume(ReservedKind kind);
 Token *consume_ident();
-void expect(char *s);
+void expect(ReservedKind kind);
 long expect_number();
 char *expect_ident();
-char *strndup(char *p, int len);
+char *intern(char *p, int len);
+int find_line(char *loc, char **line_start);
+void release_tokenizer();
 Token *tokenize();
+Token *next_token(Token *tok);
+Token *mark_token();
+void rewind_token(Token *mark);
+void drop_mark();
+Token *keep_token(Token *tok);
+void release_tokens();
+
+// 字句解析で同じ種類の文字の並びを読み飛ばす関数
+// どれも p から読み進め、止まった位置を返す
+typedef struct {
+    char *name;
+    char *(*skip_space)(char *p);       // 空白以外の文字で止まる
+    char *(*skip_ident)(char *p);       // 識別子に使えない文字で止まる
+    char *(*skip_digits)(char *p);      // 数字以外の文字で止まる
+    char *(*find_newline)(char *p);     // '\n' か NUL で止まる
+    char *(*find_star)(char *p);        // '*' か NUL で止まる
+    char *(*find_string_end)(char *p);  // '"' か '\\' か NUL で止まる
+} ScanImpl;
+
+extern ScanImpl scan;
+
+bool scan_select(char *name);
 
 //
 // Parser
@@ -135,55 +266,95 @@ typedef enum {
     ND_NUM,         // 整数リテラル
     ND_CAST,        // キャスト
     ND_NULL,        // 空の文
+    ND_KIND_NUM,
 } NodeKind;
 
+// AST のノードを指す番号
+// ノードは関数ごとに1つの連続した領域にパースした順に並べ、
+// ほかのノードを領域の先頭からのバイト数で指す、0 はノードがないことを表す
+// ポインタを含まないので、関数のノードは領域ごとそのまま写したり書き出したりできる
+typedef uint32_t NodeId;
+
 // AST のノードの型
+// すべてのノードが持つ共通の部分のあとに、ノードの種類ごとに使うフィールドだけを置く
+// ノードは種類ごとに必要な大きさ(node_size)だけ確保するので、
+// その種類が使わないフィールドを読み書きしてはいけない
 typedef struct Node Node;
 struct Node {
     NodeKind kind;      // ノードの型
-    Node *next;         // 次のノード
+    NodeId next;        // 次のノード
     Type *ty;           // 型情報 (int か *int)
     Token *tok;         // エラーメッセージ用に対応するトークンを保持
 
-    Node *lhs;          // 左辺
-    Node *rhs;          // 右辺
-
-    Node *cond;         // 条件文
-    Node *then;         // 真の場合のコード、もしくは for/while のループ本体のコード
-    Node *els;          // 偽の場合のコード
-    Node *init;         // for の初期化部のコード
-    Node *inc;          // for のインクリメント部のコード
-
-    Node *body;         // ブロックもしくはステートメント式の中身の複数の文のコード
-
-    char *member_name;  // 構造体メンバへのアクセス時に使う
-    Member *member;     // 構造体のメンバ一覧 (構造体定義のときに使う)
-
-    char *funcname;     // 関数呼び出し
-    Node *args;         // 関数引数
-
-    char *label_name;   // goto 文もしくはラベルで使う
-
-    Node *case_next;
-    Node *default_case;
-    int case_label;
-    int case_end_label;
-
-    Var *var;           // kind が ND_VAR の場合のみ使う
-    long val;           // kind が ND_NUM の場合のみ使う
+    union {
+        long val;       // ND_NUM
+        Var *var;       // ND_VAR
+
+        // 演算子、式文、return、cast、case、ラベル、構造体メンバへのアクセス
+        struct {
+            NodeId lhs;                 // 左辺、もしくは単項演算子の項や case・ラベルのついた文
+            union {
+                NodeId rhs;             // 二項演算子の右辺
+                struct {                // ND_MEMBER
+                    char *member_name;
+                    Member *member;
+                };
+                char *label_name;       // ND_LABEL, ND_GOTO (goto は lhs を使わない)
+                struct {                // ND_CASE (default も含む)
+                    NodeId case_next;   // 同じ switch 文の次の case
+                    long case_val;
+                    int case_label;
+                    int case_end_label;
+                };
+            };
+        };
+
+        // ND_IF, ND_TERNARY, ND_WHILE, ND_FOR, ND_SWITCH
+        struct {
+            NodeId cond;                // 条件文
+            NodeId then;                // 真の場合のコード、もしくは for/while/switch の本体のコード
+            union {
+                struct {
+                    NodeId els;         // 偽の場合のコード
+                    NodeId init;        // for の初期化部のコード
+                    NodeId inc;         // for のインクリメント部のコード
+                };
+                struct {                // ND_SWITCH
+                    NodeId cases;       // case 文のリスト
+                    NodeId default_case;
+                };
+            };
+        };
+
+        NodeId body;    // ND_BLOCK, ND_STMT_EXPR の中身の複数の文のコード
+
+        struct {        // ND_FUNCALL
+            char *funcname;
+            NodeId args;
+        };
+    };
 };
 
-// グローバル変数の初期化子を保持する構造体
+// グローバル変数の初期値を保持する構造体
 // グローバル変数は定数式かほかのグローバル変数へのポインタで初期化される
+// 変数全体のバイト列と、ほかの変数のアドレスを書き込む位置(リロケーション)の一覧で表す
 struct Initializer {
-    Initializer *next;
-
-    // 定数式用
-    int sz;
-    long val;
+    // バイト列は先頭の len バイトだけを持ち、size バイトになるまで 0 が続く
+    // 文字列リテラルで初期化する場合は、トークンの中身をコピーせずに指すことがある
+    char *data;
+    int len;
+    int size;
+    int cap;        // data に確保した大きさ、0 なら data は借りたもので書き換えられない
+
+    Reloc *rels;    // オフセットの昇順
+};
 
-    // 他のグローバル変数へのポインタ用
-    char *label;
+// 初期値の offset バイト目から 8 バイトに、グローバル変数 var のアドレスを書き込む
+// その 8 バイトはバイト列の側では 0 になっている
+struct Reloc {
+    Reloc *next;
+    int offset;
+    Var *var;
 };
 
 // 関数の情報を保持する構造体
@@ -193,9 +364,21 @@ struct Function {
     char *name;         // 定義した関数の名前
     VarList *params;    // 引数のリスト
 
-    Node *node;         // 関数の中身
+    char *nodes;        // 関数のノードを並べた領域
+    int nodes_size;     // 領域の大きさ
+    NodeId node;        // 関数の中身の最初の文
     VarList *locals;    // 関数が使うローカル変数のリスト
     int stack_size;     // 関数が使うスタックのサイズ
+
+    // 関数のコードのキャッシュ用
+    char *src;          // 関数定義のソースの先頭
+    char *body;         // 本体の "{" の位置
+    char *src_end;      // 本体の "}" の直後
+    uint64_t deps;      // この関数より前にあるグローバルな宣言のハッシュ
+    uint64_t cache_key;
+    char *cached;       // キャッシュにあったコード、なければ NULL
+    size_t cached_len;
+    long cached_insns;
 };
 
 // プログラムの情報を保持する構造体
@@ -205,7 +388,21 @@ typedef struct {
     Function *fns;
 } Program;
 
+// 今たどっている関数のノードの領域
+// パース中はパースしている関数の、型付けやコード生成ではその関数の Function の nodes を指す
+extern _Thread_local char *node_base;
+
+static inline Node *node_at(NodeId id) {
+    return id ? (Node *)(node_base + id) : NULL;
+}
+
+static inline NodeId node_id(Node *node) {
+    return node ? (char *)node - node_base : 0;
+}
+
+size_t node_size(NodeKind kind);
 Program *program();
+void release_parser();
 
 //
 // Type
@@ -225,12 +422,13 @@ typedef enum {
     TY_FUNC,
 } TypeKind;
 
+// 構造体型と要素数を省略した配列型以外は、同じ型なら同じオブジェクトを共有するので、
+// 作ったあとに書き換えてはいけない
 struct Type {
     TypeKind kind;
-    bool is_typedef;
-    bool is_static;
     bool is_incomplete; // incomplete array
     int align;
+    int size;           // サイズ、まだわからなければ -1
     Type *base;         // ポインタか配列型のとき、ベースとなる型が入る
     int array_size;
     Member *members;    // 構造体のメンバ
@@ -245,7 +443,8 @@ struct Member {
     int offset;
 };
 
-int align_to(int n, int align);
+size_t align_to(size_t n, size_t align);
+Type *new_type(TypeKind kind, int align);
 Type *void_type();
 Type *bool_type();
 Type *char_type();
@@ -257,6 +456,10 @@ Type *struct_type();
 Type *func_type(Type *return_ty);
 Type *pointer_to(Type *base);
 Type *array_of(Type *base, int size);
+Type *incomplete_array_of(Type *base);
+void complete_array(Type *ty, int size, Token *tok);
+void reset_types();
+void release_types();
 int size_of(Type *ty, Token* tok);
 
 void add_type(Program *prog);
@@ -265,6 +468,98 @@ void add_type(Program *prog);
 // Code generator
 //
 
+extern _Thread_local int codegen_threads;
+
 void codegen(Program *prog);
 
+//
+// Emitter
+//
+
+typedef struct OutBuf OutBuf;
+
+void emit_open(char *path, bool object);
+void emit_open_mem();
+void emit_release();
+char *emit_close_mem(size_t *len);
+OutBuf *new_outbuf();
+void free_outbuf(OutBuf *buf);
+OutBuf *emit_to(OutBuf *buf);
+void emit_append(OutBuf *buf);
+void emit(char *s);
+void emitf(char *fmt, ...);
+void emit_num(char *s, long val);
+void emit_sym(char *s, char *sym);
+void emit_ref(char *s, char *fn, int seq);
+void emit_label(char *s, char *fn, int seq);
+void emit_string(char *p, int len, bool asciz);
+void emit_nums(char *s, long *vals, int n);
+void emit_flush();
+void emit_close();
+long emit_insn_count();
+void emit_raw(char *s, size_t len, long insns);
+char *outbuf_data(OutBuf *buf, size_t *len, long *insns);
+
+//
+// Assembler
+//
+
+char *assemble(char *s, size_t len, size_t *obj_len);
+
+//
+// Cache
+//
+
+#define CACHE_HASH_INIT 0xcbf29ce484222325ul
+
+extern char *cache_dir;
+
+uint64_t hash_bytes(uint64_t h, char *p, size_t len);
+void cache_lookup(Program *prog);
+void cache_store(Function *fn, char *code, size_t code_len, long insns);
+
+//
+// Stats
+//
+
+// コンパイルのフェーズ
+typedef enum {
+    PHASE_TOKENIZE,
+    PHASE_PARSE,
+    PHASE_CACHE,
+    PHASE_ADD_TYPE,
+    PHASE_OFFSETS,
+    PHASE_CODEGEN,
+    PHASE_ASSEMBLE,
+    PHASE_NUM,
+} Phase;
+
+typedef struct {
+    bool enabled;                   // フェーズごとの時間を計るかどうか
+    double phase_time[PHASE_NUM];   // フェーズごとの時間(秒)
+    long tokens;                    // 作ったトークンの数
+    long nodes[ND_KIND_NUM];        // 種類ごとの作ったノードの数
+    long types;                     // 作った型の数
+    long lookups;                   // 変数・タグを探した回数
+    long lookup_steps;              // 探すときにたどったエントリの数の合計
+    long insns;                     // 出力した命令の数
+    long cache_hits;                // コードをキャッシュから再利用した関数の数
+    long cache_misses;              // キャッシュになくコードを生成した関数の数
+} Stats;
+
+extern _Thread_local Stats stats;
+
+char *phase_name(Phase phase);
+double now();
+void reset_stats();
+void print_time_report(FILE *fp, char *path);
+void print_stats_json(FILE *fp, char *path);
+
+//
+// Server
+//
+
+void run_server(char *path, int nworkers);
+bool run_client(char *path, char *name, char *src, size_t src_len, char *output, bool object);
+
 #endif
@@ -0,0 +1,153 @@
+#include <string.h>
+#include <sys/mman.h>
+#include "9cc.h"
+
+// 1回の mmap で確保するチャンクのサイズ
+// これより大きい要求が来た場合は、その要求専用のチャンクを確保する
+#define CHUNK_SIZE (1 << 20)
+
+// コンパイラが作るオブジェクトはポインタと long しか持たないので8バイト境界で十分
+#define ARENA_ALIGN 8
+
+// mmap で確保した連続領域
+// 先頭にこのヘッダを置き、その後ろをオブジェクトに切り出して使う
+typedef struct Chunk Chunk;
+struct Chunk {
+    Chunk *next;        // 1つ前に確保したチャンク
+    size_t size;        // ヘッダを含むチャンク全体のサイズ
+    size_t used;        // ヘッダを含む使用済みのサイズ
+};
+
+typedef struct {
+    Chunk *chunk;       // 今割り当てに使っているチャンク
+    size_t allocated;   // 割り当てたバイト数の合計
+    size_t mapped;      // mmap したバイト数の合計
+    long count;         // 割り当てたオブジェクトの数
+} Arena;
+
+// コンパイルはファイルごとに別のスレッドで行うので、領域もスレッドごとに持つ
+static _Thread_local Arena arenas[ARENA_NUM];
+
+static char *arena_names[] = {
+    "tokens",
+    "ast",
+    "types",
+    "scopes",
+};
+
+static Chunk *new_chunk(Arena *arena, size_t size, Chunk *next) {
+    void *p = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) {
+        error("arena: mmap failed: %s", strerror(errno));
+    }
+
+    Chunk *chunk = p;
+    chunk->next = next;
+    chunk->size = size;
+    chunk->used = align_to(sizeof(Chunk), ARENA_ALIGN);
+    arena->mapped += size;
+    return chunk;
+}
+
+// 指定した領域から size バイトを切り出して返す
+// mmap した領域はゼロで埋められているので、calloc と同じく中身はゼロになっている
+void *arena_alloc(ArenaKind kind, size_t size) {
+    Arena *arena = &arenas[kind];
+    size = align_to(size, ARENA_ALIGN);
+    arena->allocated += size;
+    arena->count++;
+
+    Chunk *chunk = arena->chunk;
+    if (!chunk || chunk->size - chunk->used < size) {
+        size_t header = align_to(sizeof(Chunk), ARENA_ALIGN);
+        if (header + size > CHUNK_SIZE) {
+            // 大きなオブジェクトは専用のチャンクに置き、今のチャンクはそのまま使い続ける
+            size_t sz = align_to(header + size, CHUNK_SIZE);
+            Chunk *big = new_chunk(arena, sz, chunk ? chunk->next : NULL);
+            big->used += size;
+            if (chunk) {
+                chunk->next = big;
+            }
+            else {
+                arena->chunk = big;
+            }
+            return (char *)big + header;
+        }
+        chunk = arena->chunk = new_chunk(arena, CHUNK_SIZE, chunk);
+    }
+
+    void *p = (char *)chunk + chunk->used;
+    chunk->used += size;
+    return p;
+}
+
+// 領域に割り当てたオブジェクトをまとめて解放する
+// 最初のチャンクだけは次のコンパイルのために残し、ゼロで埋め直しておく
+void arena_reset(ArenaKind kind) {
+    Arena *arena = &arenas[kind];
+    Chunk *chunk = arena->chunk;
+    Chunk *keep = NULL;
+
+    while (chunk) {
+        Chunk *next = chunk->next;
+        if (!next && chunk->size == CHUNK_SIZE) {
+            keep = chunk;
+            break;
+        }
+        munmap(chunk, chunk->size);
+        chunk = next;
+    }
+
+    arena->chunk = keep;
+    arena->allocated = 0;
+    arena->count = 0;
+    arena->mapped = 0;
+
+    if (keep) {
+        size_t header = align_to(sizeof(Chunk), ARENA_ALIGN);
+        memset((char *)keep + header, 0, keep->used - header);
+        keep->used = header;
+        arena->mapped = keep->size;
+    }
+}
+
+// 文字列の先頭 len 文字をトークン用の領域に複製する
+char *arena_strndup(char *p, int len) {
+    char *buf = arena_alloc(ARENA_TOKEN, len + 1);
+    memcpy(buf, p, len);
+    return buf;
+}
+
+// 次のコンパイルのために残しているチャンクも含めて、このスレッドの領域をすべて解放する
+void arena_release_all() {
+    for (int i = 0; i < ARENA_NUM; i++) {
+        arena_reset(i);
+        Arena *arena = &arenas[i];
+        if (arena->chunk) {
+            munmap(arena->chunk, arena->chunk->size);
+        }
+        *arena = (Arena){};
+    }
+}
+
+void arena_reset_all() {
+    for (int i = 0; i < ARENA_NUM; i++) {
+        arena_reset(i);
+    }
+}
+
+// 領域ごとの使用量を出力する
+void arena_report(FILE *fp) {
+    size_t allocated = 0;
+    size_t mapped = 0;
+
+    fprintf(fp, "%-8s %12s %12s %10s\n", "region", "allocated", "mapped", "objects");
+    for (int i = 0; i < ARENA_NUM; i++) {
+        Arena *arena = &arenas[i];
+        fprintf(fp, "%-8s %12zu %12zu %10ld\n",
+                arena_names[i], arena->allocated, arena->mapped, arena->count);
+        allocated += arena->allocated;
+        mapped += arena->mapped;
+    }
+    fprintf(fp, "%-8s %12zu %12zu\n", "total", allocated, mapped);
+}
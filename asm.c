@@ -0,0 +1,1402 @@
+#include <elf.h>
+#include <string.h>
+#include "9cc.h"
+
+// 生成したアセンブリから ELF64 の再配置可能オブジェクトファイルを作るアセンブラ
+//
+// コード生成は関数ごとにアセンブリのテキストを作り、キャッシュにもテキストのまま保存するので、
+// アセンブラは出力先に集めたテキストを1行ずつ読んで機械語に変える
+// 読めるのは 9cc が出力する形の命令とディレクティブだけで、それ以外はエラーにする
+//
+// ジャンプと関数呼び出しは、すべて 32 ビットの相対アドレスの形にする
+// 命令の長さがラベルの位置によらないので、1回読むだけで配置が決まり、
+// 最後にラベルを参照している箇所を埋めるか、リンカのための再配置情報にする
+
+//
+// バイト列
+//
+
+typedef struct {
+    char *data;
+    size_t len;
+    size_t cap;
+} Bytes;
+
+static void bytes_put(Bytes *b, void *p, size_t n) {
+    if (n == 0) {
+        return;
+    }
+    if (b->len + n > b->cap) {
+        size_t cap = b->cap ? b->cap : 4096;
+        while (b->len + n > cap) {
+            cap *= 2;
+        }
+        b->data = realloc(b->data, cap);
+        if (!b->data) {
+            error("out of memory");
+        }
+        b->cap = cap;
+    }
+    memcpy(b->data + b->len, p, n);
+    b->len += n;
+}
+
+// n バイトの値 val をリトルエンディアンで書き込む
+static void bytes_put_val(Bytes *b, uint64_t val, int n) {
+    char buf[8];
+    for (int i = 0; i < n; i++) {
+        buf[i] = val >> (i * 8);
+    }
+    bytes_put(b, buf, n);
+}
+
+static void bytes_pad(Bytes *b, size_t align) {
+    while (b->len % align) {
+        bytes_put(b, "", 1);
+    }
+}
+
+//
+// セクションとシンボル
+//
+
+typedef struct AsmSection AsmSection;
+typedef struct AsmSymbol AsmSymbol;
+
+// あとで埋める、もしくは再配置情報にするシンボルの参照
+typedef struct {
+    uint64_t offset;    // セクションの中で値を書き込む位置
+    uint32_t type;      // R_X86_64_*
+    AsmSymbol *sym;
+    int64_t addend;
+} Fixup;
+
+struct AsmSection {
+    char *name;
+    uint32_t type;      // SHT_PROGBITS か SHT_NOBITS
+    uint64_t flags;     // SHF_*
+    uint64_t entsize;
+    uint64_t align;
+    Bytes data;         // SHT_NOBITS のセクションは中身を持たない
+    uint64_t size;      // SHT_NOBITS のセクションの大きさ
+
+    Fixup *fixups;
+    int nfixups;
+    int fixups_cap;
+
+    Elf64_Rela *relas;  // リンカに渡す再配置情報
+    int nrelas;
+
+    int index;          // セクションヘッダの番号
+    int sym_index;      // セクションを表すシンボルの番号
+    int rela_index;     // 再配置情報のセクションヘッダの番号
+};
+
+struct AsmSymbol {
+    char *name;         // NUL 終端されていない
+    int len;
+    AsmSection *sec;    // 定義されたセクション、NULL なら未定義
+    uint64_t value;     // セクションの中の位置
+    uint64_t size;
+    int type;           // STT_*
+    bool is_global;
+    bool is_used;       // どこかから参照されている
+    int index;          // シンボルテーブルの番号、0 ならシンボルテーブルに入れない
+};
+
+// 1つのファイルに出てくるセクションは 9cc が使う数だけ
+#define MAX_SECTIONS 16
+
+// アセンブルしているファイルの状態
+// 複数のファイルを別のスレッドで同時にアセンブルできるよう、スレッドごとに持つ
+static _Thread_local AsmSection sections[MAX_SECTIONS];
+static _Thread_local int nsections;
+static _Thread_local AsmSection *cur_sec;
+static _Thread_local int line_num;
+
+// シンボルは名前で引くハッシュ表に入れる
+// ラベルは関数ごとにたくさんあるので、線形探索では遅い
+static _Thread_local AsmSymbol **sym_table;
+static _Thread_local int sym_capacity;
+static _Thread_local int sym_used;
+
+static void asm_error(char *fmt, char *s, int len) {
+    error("assembler: line %d: %s: %.*s", line_num, fmt, len, s);
+}
+
+static AsmSymbol *find_symbol(char *name, int len) {
+    if (sym_used * 2 >= sym_capacity) {
+        // 表が半分埋まったら、倍の大きさの表に入れなおす
+        int cap = sym_capacity ? sym_capacity * 2 : 1024;
+        AsmSymbol **table = calloc(cap, sizeof(AsmSymbol *));
+        for (int i = 0; i < sym_capacity; i++) {
+            AsmSymbol *sym = sym_table[i];
+            if (sym) {
+                int j = hash_bytes(CACHE_HASH_INIT, sym->name, sym->len) & (cap - 1);
+                while (table[j]) {
+                    j = (j + 1) & (cap - 1);
+                }
+                table[j] = sym;
+            }
+        }
+        free(sym_table);
+        sym_table = table;
+        sym_capacity = cap;
+    }
+
+    int i = hash_bytes(CACHE_HASH_INIT, name, len) & (sym_capacity - 1);
+    for (; sym_table[i]; i = (i + 1) & (sym_capacity - 1)) {
+        AsmSymbol *sym = sym_table[i];
+        if (sym->len == len && !memcmp(sym->name, name, len)) {
+            return sym;
+        }
+    }
+
+    AsmSymbol *sym = calloc(1, sizeof(AsmSymbol));
+    sym->name = name;
+    sym->len = len;
+    sym_table[i] = sym;
+    sym_used++;
+    return sym;
+}
+
+// .L で始まるラベルはアセンブラの中だけで使い、シンボルテーブルに入れない
+static bool is_local_label(AsmSymbol *sym) {
+    return sym->len >= 2 && sym->name[0] == '.' && sym->name[1] == 'L';
+}
+
+// name のセクションに切り替える、なければ作る
+static void switch_section(char *name, int len, uint32_t type, uint64_t flags, uint64_t entsize) {
+    for (int i = 0; i < nsections; i++) {
+        if (strlen(sections[i].name) == len && !strncmp(sections[i].name, name, len)) {
+            cur_sec = &sections[i];
+            return;
+        }
+    }
+    if (nsections == MAX_SECTIONS) {
+        asm_error("too many sections", name, len);
+    }
+
+    AsmSection *sec = &sections[nsections++];
+    memset(sec, 0, sizeof(AsmSection));
+    sec->name = strndup(name, len);
+    sec->type = type;
+    sec->flags = flags;
+    sec->entsize = entsize;
+    sec->align = 1;
+    cur_sec = sec;
+}
+
+static uint64_t section_size(AsmSection *sec) {
+    return sec->type == SHT_NOBITS ? sec->size : sec->data.len;
+}
+
+// 今のセクションに書き込む
+static void out(void *p, size_t n) {
+    if (cur_sec->type == SHT_NOBITS) {
+        error("assembler: line %d: data in %s", line_num, cur_sec->name);
+    }
+    bytes_put(&cur_sec->data, p, n);
+}
+
+static void out_byte(int c) {
+    char b = c;
+    out(&b, 1);
+}
+
+static void out_val(uint64_t val, int n) {
+    if (cur_sec->type == SHT_NOBITS) {
+        error("assembler: line %d: data in %s", line_num, cur_sec->name);
+    }
+    bytes_put_val(&cur_sec->data, val, n);
+}
+
+// 今の位置から n バイトに、シンボル sym を使った値をあとで書き込む
+static void out_fixup(uint32_t type, AsmSymbol *sym, int64_t addend, int n) {
+    AsmSection *sec = cur_sec;
+    if (sec->nfixups == sec->fixups_cap) {
+        sec->fixups_cap = sec->fixups_cap ? sec->fixups_cap * 2 : 256;
+        sec->fixups = realloc(sec->fixups, sizeof(Fixup) * sec->fixups_cap);
+    }
+    sec->fixups[sec->nfixups++] = (Fixup){section_size(sec), type, sym, addend};
+    sym->is_used = true;
+    out_val(0, n);
+}
+
+//
+// 行の読み取り
+//
+
+static char *skip_spaces(char *p, char *end) {
+    while (p < end && (*p == ' ' || *p == '\t')) {
+        p++;
+    }
+    return p;
+}
+
+static bool is_word_char(char c) {
+    return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || ('0' <= c && c <= '9') ||
+           c == '_' || c == '.' || c == '@' || c == '$';
+}
+
+// p から始まる単語の終わりを返す
+static char *skip_word(char *p, char *end) {
+    while (p < end && is_word_char(*p)) {
+        p++;
+    }
+    return p;
+}
+
+// 名前の表を順に比べることが多いので、先頭の文字が違えばすぐに返す
+static bool equals(char *p, int len, char *s) {
+    return len > 0 && *p == *s && strlen(s) == len && !strncmp(p, s, len);
+}
+
+static bool is_number(char *p, char *end) {
+    return p < end && (('0' <= *p && *p <= '9') || *p == '-');
+}
+
+// 数値を読む、数値でなければエラー
+static int64_t read_number(char **p, char *end) {
+    char *q;
+    int64_t val = strtoll(*p, &q, 0);
+    if (q == *p || q > end) {
+        asm_error("number expected", *p, end - *p);
+    }
+    *p = q;
+    return val;
+}
+
+// カンマで区切られた次の項目の先頭に進む、なければ end を返す
+static char *next_item(char *p, char *end) {
+    p = skip_spaces(p, end);
+    if (p == end) {
+        return end;
+    }
+    if (*p != ',') {
+        asm_error("',' expected", p, end - p);
+    }
+    return skip_spaces(p + 1, end);
+}
+
+//
+// 命令のオペランド
+//
+
+typedef enum {
+    OP_REG,
+    OP_MEM,     // [base+disp]
+    OP_IMM,     // 即値、sym があれば offset sym
+    OP_SYM,     // ジャンプや関数呼び出しの飛び先
+} OperandKind;
+
+typedef struct {
+    OperandKind kind;
+    int size;           // バイト数、メモリで大きさの指定がなければ 0
+    int reg;            // OP_REG のレジスタ、OP_MEM のベースレジスタ
+    int64_t val;        // OP_MEM の変位、OP_IMM の値
+    AsmSymbol *sym;
+} Operand;
+
+typedef struct {
+    char *name;
+    int reg;
+    int size;
+} RegName;
+
+static RegName regs[] = {
+    {"rax", 0, 8}, {"rcx", 1, 8}, {"rdx", 2, 8}, {"rbx", 3, 8},
+    {"rsp", 4, 8}, {"rbp", 5, 8}, {"rsi", 6, 8}, {"rdi", 7, 8},
+    {"r8", 8, 8}, {"r9", 9, 8}, {"r10", 10, 8}, {"r11", 11, 8},
+    {"r12", 12, 8}, {"r13", 13, 8}, {"r14", 14, 8}, {"r15", 15, 8},
+    {"eax", 0, 4}, {"ecx", 1, 4}, {"edx", 2, 4}, {"ebx", 3, 4},
+    {"esp", 4, 4}, {"ebp", 5, 4}, {"esi", 6, 4}, {"edi", 7, 4},
+    {"r8d", 8, 4}, {"r9d", 9, 4}, {"r10d", 10, 4}, {"r11d", 11, 4},
+    {"r12d", 12, 4}, {"r13d", 13, 4}, {"r14d", 14, 4}, {"r15d", 15, 4},
+    {"ax", 0, 2}, {"cx", 1, 2}, {"dx", 2, 2}, {"bx", 3, 2},
+    {"sp", 4, 2}, {"bp", 5, 2}, {"si", 6, 2}, {"di", 7, 2},
+    {"r8w", 8, 2}, {"r9w", 9, 2}, {"r10w", 10, 2}, {"r11w", 11, 2},
+    {"r12w", 12, 2}, {"r13w", 13, 2}, {"r14w", 14, 2}, {"r15w", 15, 2},
+    {"al", 0, 1}, {"cl", 1, 1}, {"dl", 2, 1}, {"bl", 3, 1},
+    {"spl", 4, 1}, {"bpl", 5, 1}, {"sil", 6, 1}, {"dil", 7, 1},
+    {"r8b", 8, 1}, {"r9b", 9, 1}, {"r10b", 10, 1}, {"r11b", 11, 1},
+    {"r12b", 12, 1}, {"r13b", 13, 1}, {"r14b", 14, 1}, {"r15b", 15, 1},
+};
+
+static RegName *find_reg(char *p, int len) {
+    for (int i = 0; i < sizeof(regs) / sizeof(*regs); i++) {
+        if (equals(p, len, regs[i].name)) {
+            return &regs[i];
+        }
+    }
+    return NULL;
+}
+
+// 大きさの指定 "byte ptr" などを読む
+static int read_ptr_size(char **p, char *end) {
+    static struct { char *name; int size; } sizes[] = {
+        {"byte", 1}, {"word", 2}, {"dword", 4}, {"qword", 8},
+    };
+    char *q = skip_word(*p, end);
+    for (int i = 0; i < 4; i++) {
+        if (equals(*p, q - *p, sizes[i].name)) {
+            char *r = skip_spaces(q, end);
+            char *s = skip_word(r, end);
+            if (!equals(r, s - r, "ptr")) {
+                asm_error("'ptr' expected", r, end - r);
+            }
+            *p = skip_spaces(s, end);
+            return sizes[i].size;
+        }
+    }
+    return 0;
+}
+
+// [ から始まるメモリのオペランドを読む
+static void read_mem(char **p, char *end, Operand *op) {
+    char *q = skip_spaces(*p + 1, end);
+    char *r = skip_word(q, end);
+    RegName *reg = find_reg(q, r - q);
+    if (!reg || reg->size != 8) {
+        asm_error("base register expected", q, end - q);
+    }
+    op->kind = OP_MEM;
+    op->reg = reg->reg;
+    op->val = 0;
+
+    r = skip_spaces(r, end);
+    if (r < end && (*r == '+' || *r == '-')) {
+        bool neg = *r == '-';
+        r = skip_spaces(r + 1, end);
+        op->val = read_number(&r, end);
+        if (neg) {
+            op->val = -op->val;
+        }
+        r = skip_spaces(r, end);
+    }
+    if (r == end || *r != ']') {
+        asm_error("']' expected", r, end - r);
+    }
+    *p = r + 1;
+}
+
+// オペランドを1つ読み、次のオペランドの先頭か end を返す
+static char *read_operand(char *p, char *end, Operand *op) {
+    memset(op, 0, sizeof(Operand));
+    op->size = read_ptr_size(&p, end);
+
+    if (p < end && *p == '[') {
+        read_mem(&p, end, op);
+        return next_item(p, end);
+    }
+    if (op->size) {
+        asm_error("memory operand expected", p, end - p);
+    }
+
+    if (is_number(p, end)) {
+        op->kind = OP_IMM;
+        op->val = read_number(&p, end);
+        return next_item(p, end);
+    }
+
+    char *q = skip_word(p, end);
+    if (q == p) {
+        asm_error("operand expected", p, end - p);
+    }
+    if (equals(p, q - p, "offset")) {
+        // offset sym はシンボルのアドレスの即値
+        p = skip_spaces(q, end);
+        q = skip_word(p, end);
+        op->kind = OP_IMM;
+        op->sym = find_symbol(p, q - p);
+        return next_item(q, end);
+    }
+
+    RegName *reg = find_reg(p, q - p);
+    if (reg) {
+        op->kind = OP_REG;
+        op->reg = reg->reg;
+        op->size = reg->size;
+    }
+    else {
+        op->kind = OP_SYM;
+        op->sym = find_symbol(p, q - p);
+    }
+    return next_item(q, end);
+}
+
+//
+// 命令のエンコード
+//
+
+// 8 ビットのレジスタの spl, bpl, sil, dil は、REX プレフィックスがないと ah などの意味になる
+static bool needs_rex8(Operand *op) {
+    return op && op->kind == OP_REG && op->size == 1 && 4 <= op->reg && op->reg < 8;
+}
+
+static bool is_imm8(int64_t val) {
+    return -128 <= val && val <= 127;
+}
+
+static bool is_imm32(int64_t val) {
+    return INT32_MIN <= val && val <= INT32_MAX;
+}
+
+// ModR/M の形の命令を書き込む
+// reg フィールドには reg のレジスタか、reg が NULL なら digit を、r/m フィールドには rm を入れる
+// size はオペランドの大きさで、2 ならオペランドサイズのプレフィックスを、8 なら REX.W をつける
+static void encode_rm(int size, int opcode, int oplen, Operand *reg, int digit, Operand *rm) {
+    int r = reg ? reg->reg : digit;
+
+    if (size == 2) {
+        out_byte(0x66);
+    }
+    int rex = 0;
+    if (size == 8) {
+        rex |= 8;
+    }
+    if (r >= 8) {
+        rex |= 4;
+    }
+    if (rm->reg >= 8) {
+        rex |= 1;
+    }
+    if (rex || needs_rex8(reg) || needs_rex8(rm)) {
+        out_byte(0x40 | rex);
+    }
+
+    // 2 バイトのオペコードは 0x0f から始まる
+    if (oplen == 2) {
+        out_byte(opcode >> 8);
+    }
+    out_byte(opcode);
+
+    if (rm->kind == OP_REG) {
+        out_byte(0xc0 | (r & 7) << 3 | (rm->reg & 7));
+        return;
+    }
+
+    // rbp と r13 をベースにするときは、変位が 0 でも省略できない
+    int base = rm->reg & 7;
+    int mod;
+    if (rm->val == 0 && base != 5) {
+        mod = 0;
+    }
+    else if (is_imm8(rm->val)) {
+        mod = 1;
+    }
+    else {
+        mod = 2;
+    }
+    out_byte(mod << 6 | (r & 7) << 3 | base);
+    // rsp と r12 をベースにするときは、インデックスなしの SIB バイトが必要
+    if (base == 4) {
+        out_byte(0x24);
+    }
+    if (mod == 1) {
+        out_byte(rm->val);
+    }
+    else if (mod == 2) {
+        out_val(rm->val, 4);
+    }
+}
+
+// 64 ビットのレジスタをオペコードの下位 3 ビットで指定する命令(push, pop など)
+static void encode_reg_in_opcode(int opcode, int reg, bool rex_w) {
+    if (reg >= 8 || rex_w) {
+        out_byte(0x40 | (rex_w ? 8 : 0) | (reg >= 8 ? 1 : 0));
+    }
+    out_byte(opcode + (reg & 7));
+}
+
+// 条件の名前から条件コードを返す
+static int cond_code(char *p, int len) {
+    static char *names[] = {
+        "o", "no", "b", "ae", "e", "ne", "be", "a", "s", "ns", "p", "np", "l", "ge", "le", "g",
+    };
+    for (int i = 0; i < 16; i++) {
+        if (equals(p, len, names[i])) {
+            return i;
+        }
+    }
+    if (equals(p, len, "z")) {
+        return 4;
+    }
+    if (equals(p, len, "nz")) {
+        return 5;
+    }
+    return -1;
+}
+
+// 32 ビットの相対アドレスで飛び先を書き込む
+static void out_rel32(Operand *op) {
+    if (op->kind != OP_SYM) {
+        error("assembler: line %d: jump target expected", line_num);
+    }
+    // 相対アドレスは次の命令の先頭から数えるので、値を書き込む 4 バイトの分だけずらす
+    out_fixup(R_X86_64_PC32, op->sym, -4, 4);
+}
+
+// 加算などの2項演算の reg フィールドの値
+static int alu_digit(char *p, int len) {
+    static char *names[] = {"add", "or", "adc", "sbb", "and", "sub", "xor", "cmp"};
+    for (int i = 0; i < 8; i++) {
+        if (equals(p, len, names[i])) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void bad_operands(char *name, int len) {
+    asm_error("invalid operands", name, len);
+}
+
+// オペランドの大きさ、どちらかがレジスタならその大きさ
+static int operand_size(Operand *a, Operand *b) {
+    if (a->size) {
+        return a->size;
+    }
+    return b ? b->size : 0;
+}
+
+static void asm_insn(char *name, int len, Operand *ops, int nops) {
+    Operand *a = nops > 0 ? &ops[0] : NULL;
+    Operand *b = nops > 1 ? &ops[1] : NULL;
+
+    if (nops == 0) {
+        if (equals(name, len, "ret")) {
+            out_byte(0xc3);
+        }
+        else if (equals(name, len, "cqo")) {
+            out_byte(0x48);
+            out_byte(0x99);
+        }
+        else if (equals(name, len, "leave")) {
+            out_byte(0xc9);
+        }
+        else if (equals(name, len, "nop")) {
+            out_byte(0x90);
+        }
+        else {
+            asm_error("unknown instruction", name, len);
+        }
+        return;
+    }
+
+    if (nops == 1) {
+        if (equals(name, len, "push")) {
+            if (a->kind == OP_REG && a->size == 8) {
+                encode_reg_in_opcode(0x50, a->reg, false);
+            }
+            else if (a->kind == OP_IMM && a->sym) {
+                // 静的リンクのアドレスは 32 ビットの符号つき即値に収まる
+                out_byte(0x68);
+                out_fixup(R_X86_64_32S, a->sym, a->val, 4);
+            }
+            else if (a->kind == OP_IMM && is_imm8(a->val)) {
+                out_byte(0x6a);
+                out_byte(a->val);
+            }
+            else if (a->kind == OP_IMM && is_imm32(a->val)) {
+                out_byte(0x68);
+                out_val(a->val, 4);
+            }
+            else if (a->kind == OP_MEM) {
+                encode_rm(0, 0xff, 1, NULL, 6, a);
+            }
+            else {
+                bad_operands(name, len);
+            }
+            return;
+        }
+        if (equals(name, len, "pop")) {
+            if (a->kind == OP_REG && a->size == 8) {
+                encode_reg_in_opcode(0x58, a->reg, false);
+            }
+            else if (a->kind == OP_MEM) {
+                encode_rm(0, 0x8f, 1, NULL, 0, a);
+            }
+            else {
+                bad_operands(name, len);
+            }
+            return;
+        }
+        if (equals(name, len, "jmp")) {
+            out_byte(0xe9);
+            out_rel32(a);
+            return;
+        }
+        if (equals(name, len, "call")) {
+            out_byte(0xe8);
+            out_rel32(a);
+            return;
+        }
+        if (name[0] == 'j' && cond_code(name + 1, len - 1) >= 0) {
+            out_byte(0x0f);
+            out_byte(0x80 + cond_code(name + 1, len - 1));
+            out_rel32(a);
+            return;
+        }
+        if (len > 3 && !strncmp(name, "set", 3) && cond_code(name + 3, len - 3) >= 0) {
+            if (a->kind == OP_MEM ? a->size != 1 && a->size != 0 : a->size != 1) {
+                bad_operands(name, len);
+            }
+            encode_rm(0, 0x0f90 + cond_code(name + 3, len - 3), 2, NULL, 0, a);
+            return;
+        }
+
+        // F7 /n の1オペランドの演算
+        static struct { char *name; int digit; } unary[] = {
+            {"not", 2}, {"neg", 3}, {"mul", 4}, {"imul", 5}, {"div", 6}, {"idiv", 7},
+        };
+        for (int i = 0; i < sizeof(unary) / sizeof(*unary); i++) {
+            if (equals(name, len, unary[i].name)) {
+                int size = operand_size(a, NULL);
+                if (a->kind == OP_IMM || a->kind == OP_SYM || !size) {
+                    bad_operands(name, len);
+                }
+                encode_rm(size, size == 1 ? 0xf6 : 0xf7, 1, NULL, unary[i].digit, a);
+                return;
+            }
+        }
+        asm_error("unknown instruction", name, len);
+    }
+
+    if (nops != 2 || a->kind == OP_IMM || a->kind == OP_SYM || b->kind == OP_SYM) {
+        bad_operands(name, len);
+    }
+    int size = operand_size(a, b);
+
+    int digit = alu_digit(name, len);
+    if (digit >= 0) {
+        if (b->kind == OP_REG) {
+            encode_rm(size, digit * 8 + (size == 1 ? 0 : 1), 1, b, 0, a);
+        }
+        else if (b->kind == OP_MEM && a->kind == OP_REG) {
+            encode_rm(size, digit * 8 + (size == 1 ? 2 : 3), 1, a, 0, b);
+        }
+        else if (b->kind == OP_IMM && !b->sym && size == 1) {
+            encode_rm(size, 0x80, 1, NULL, digit, a);
+            out_byte(b->val);
+        }
+        else if (b->kind == OP_IMM && !b->sym && is_imm8(b->val)) {
+            encode_rm(size, 0x83, 1, NULL, digit, a);
+            out_byte(b->val);
+        }
+        else if (b->kind == OP_IMM && !b->sym && is_imm32(b->val) && size) {
+            encode_rm(size, 0x81, 1, NULL, digit, a);
+            out_val(b->val, size == 2 ? 2 : 4);
+        }
+        else {
+            bad_operands(name, len);
+        }
+        return;
+    }
+
+    if (equals(name, len, "mov")) {
+        if (b->kind == OP_REG && (a->kind == OP_REG || a->kind == OP_MEM)) {
+            encode_rm(size, size == 1 ? 0x88 : 0x89, 1, b, 0, a);
+        }
+        else if (b->kind == OP_MEM && a->kind == OP_REG) {
+            encode_rm(size, size == 1 ? 0x8a : 0x8b, 1, a, 0, b);
+        }
+        else if (b->kind == OP_IMM && !b->sym && a->kind == OP_REG && size == 8 && is_imm32(b->val)) {
+            // 符号拡張される 32 ビットの即値
+            encode_rm(8, 0xc7, 1, NULL, 0, a);
+            out_val(b->val, 4);
+        }
+        else if (b->kind == OP_IMM && !b->sym && a->kind == OP_REG && size == 8) {
+            encode_reg_in_opcode(0xb8, a->reg, true);
+            out_val(b->val, 8);
+        }
+        else if (b->kind == OP_IMM && !b->sym && a->kind == OP_REG) {
+            if (size == 2) {
+                out_byte(0x66);
+            }
+            if (a->reg >= 8 || needs_rex8(a)) {
+                out_byte(0x40 | (a->reg >= 8 ? 1 : 0));
+            }
+            out_byte((size == 1 ? 0xb0 : 0xb8) + (a->reg & 7));
+            out_val(b->val, size);
+        }
+        else {
+            bad_operands(name, len);
+        }
+        return;
+    }
+
+    if (equals(name, len, "movabs")) {
+        if (a->kind != OP_REG || a->size != 8 || b->kind != OP_IMM || b->sym) {
+            bad_operands(name, len);
+        }
+        encode_reg_in_opcode(0xb8, a->reg, true);
+        out_val(b->val, 8);
+        return;
+    }
+
+    if (equals(name, len, "movsxd")) {
+        if (a->kind != OP_REG || a->size != 8 || b->kind == OP_IMM || (b->size && b->size != 4)) {
+            bad_operands(name, len);
+        }
+        encode_rm(8, 0x63, 1, a, 0, b);
+        return;
+    }
+
+    // 符号拡張とゼロ拡張、大きさは元のオペランドの大きさで決まる
+    bool is_movsx = equals(name, len, "movsx");
+    bool is_movzx = equals(name, len, "movzx");
+    if (is_movsx || is_movzx || equals(name, len, "movzb") || equals(name, len, "movzw")) {
+        int from = b->size;
+        if (!from) {
+            from = name[4] == 'b' ? 1 : 2;
+        }
+        if (a->kind != OP_REG || b->kind == OP_IMM || (from != 1 && from != 2) ||
+            a->size <= from) {
+            bad_operands(name, len);
+        }
+        int opcode = (is_movsx ? 0x0fbe : 0x0fb6) + (from == 2 ? 1 : 0);
+        encode_rm(a->size, opcode, 2, a, 0, b);
+        return;
+    }
+
+    if (equals(name, len, "imul")) {
+        if (a->kind != OP_REG || size == 1) {
+            bad_operands(name, len);
+        }
+        if (b->kind == OP_IMM) {
+            // 3オペランドの imul a, a, imm
+            if (b->sym || !is_imm32(b->val)) {
+                bad_operands(name, len);
+            }
+            encode_rm(size, is_imm8(b->val) ? 0x6b : 0x69, 1, a, 0, a);
+            out_val(b->val, is_imm8(b->val) ? 1 : size == 2 ? 2 : 4);
+        }
+        else {
+            encode_rm(size, 0x0faf, 2, a, 0, b);
+        }
+        return;
+    }
+
+    if (equals(name, len, "lea")) {
+        if (a->kind != OP_REG || b->kind != OP_MEM || a->size == 1) {
+            bad_operands(name, len);
+        }
+        encode_rm(a->size, 0x8d, 1, a, 0, b);
+        return;
+    }
+
+    if (equals(name, len, "test")) {
+        if (b->kind != OP_REG) {
+            bad_operands(name, len);
+        }
+        encode_rm(size, size == 1 ? 0x84 : 0x85, 1, b, 0, a);
+        return;
+    }
+
+    // シフト、シフトする数は cl か即値
+    static struct { char *name; int digit; } shifts[] = {
+        {"rol", 0}, {"ror", 1}, {"shl", 4}, {"sal", 4}, {"shr", 5}, {"sar", 7},
+    };
+    for (int i = 0; i < sizeof(shifts) / sizeof(*shifts); i++) {
+        if (!equals(name, len, shifts[i].name)) {
+            continue;
+        }
+        if (!a->size) {
+            bad_operands(name, len);
+        }
+        if (b->kind == OP_REG && b->reg == 1 && b->size == 1) {
+            encode_rm(a->size, a->size == 1 ? 0xd2 : 0xd3, 1, NULL, shifts[i].digit, a);
+        }
+        else if (b->kind == OP_IMM && !b->sym) {
+            encode_rm(a->size, a->size == 1 ? 0xc0 : 0xc1, 1, NULL, shifts[i].digit, a);
+            out_byte(b->val);
+        }
+        else {
+            bad_operands(name, len);
+        }
+        return;
+    }
+
+    asm_error("unknown instruction", name, len);
+}
+
+// 命令の行を読む
+static void asm_insn_line(char *p, char *end) {
+    char *name = p;
+    char *q = skip_word(p, end);
+    int len = q - name;
+
+    Operand ops[3];
+    int nops = 0;
+    p = skip_spaces(q, end);
+    while (p < end) {
+        if (nops == 3) {
+            asm_error("too many operands", name, end - name);
+        }
+        p = read_operand(p, end, &ops[nops++]);
+    }
+    asm_insn(name, len, ops, nops);
+}
+
+//
+// ディレクティブ
+//
+
+// .ascii の文字列を読み、NUL 文字を含めずに書き込む
+static char *asm_string(char *p, char *end) {
+    if (p == end || *p != '"') {
+        asm_error("string expected", p, end - p);
+    }
+    p++;
+
+    for (;;) {
+        if (p == end) {
+            asm_error("unclosed string", p, 0);
+        }
+        // エスケープのない部分はまとめて書き込む
+        char *q = p;
+        while (q < end && *q != '"' && *q != '\\') {
+            q++;
+        }
+        out(p, q - p);
+        p = q;
+        if (p < end && *p == '"') {
+            return p + 1;
+        }
+        if (p + 1 >= end) {
+            asm_error("unclosed string", p, end - p);
+        }
+
+        // emit_string は8進数のエスケープを出力するが、ほかのエスケープも読めるようにしておく
+        char c = p[1];
+        p += 2;
+        if ('0' <= c && c <= '7') {
+            int val = c - '0';
+            for (int i = 0; i < 2 && p < end && '0' <= *p && *p <= '7'; i++) {
+                val = val * 8 + (*p++ - '0');
+            }
+            out_byte(val);
+        }
+        else if (c == 'n') {
+            out_byte('\n');
+        }
+        else if (c == 't') {
+            out_byte('\t');
+        }
+        else if (c == 'r') {
+            out_byte('\r');
+        }
+        else if (c == 'b') {
+            out_byte('\b');
+        }
+        else if (c == 'f') {
+            out_byte('\f');
+        }
+        else {
+            out_byte(c);
+        }
+    }
+}
+
+// .section name[,"flags"[,@type[,entsize]]]
+static void asm_section(char *p, char *end) {
+    char *name = p;
+    char *q = skip_word(p, end);
+    int len = q - name;
+
+    // フラグを省略した場合は、よく使われる名前ならそれに合わせる
+    uint32_t type = SHT_PROGBITS;
+    uint64_t flags = SHF_ALLOC;
+    uint64_t entsize = 0;
+    if (equals(name, len, ".text")) {
+        flags = SHF_ALLOC | SHF_EXECINSTR;
+    }
+    else if (equals(name, len, ".data") || !strncmp(name, ".data.", 6)) {
+        flags = SHF_ALLOC | SHF_WRITE;
+    }
+    else if (equals(name, len, ".bss")) {
+        type = SHT_NOBITS;
+        flags = SHF_ALLOC | SHF_WRITE;
+    }
+
+    p = next_item(q, end);
+    if (p < end) {
+        if (*p != '"') {
+            asm_error("section flags expected", p, end - p);
+        }
+        flags = 0;
+        for (p++; p < end && *p != '"'; p++) {
+            switch (*p) {
+            case 'a': flags |= SHF_ALLOC; break;
+            case 'w': flags |= SHF_WRITE; break;
+            case 'x': flags |= SHF_EXECINSTR; break;
+            case 'M': flags |= SHF_MERGE; break;
+            case 'S': flags |= SHF_STRINGS; break;
+            default:
+                asm_error("unknown section flag", p, 1);
+            }
+        }
+        p = next_item(p + 1, end);
+    }
+    if (p < end) {
+        q = skip_word(p, end);
+        if (equals(p, q - p, "@nobits")) {
+            type = SHT_NOBITS;
+        }
+        else if (!equals(p, q - p, "@progbits")) {
+            asm_error("unknown section type", p, q - p);
+        }
+        p = next_item(q, end);
+    }
+    if (p < end) {
+        entsize = read_number(&p, end);
+    }
+    switch_section(name, len, type, flags, entsize);
+}
+
+// .byte, .short, .long, .quad の値を書き込む
+static void asm_values(char *p, char *end, int size) {
+    while (p < end) {
+        if (is_number(p, end)) {
+            out_val(read_number(&p, end), size);
+        }
+        else {
+            // ほかのグローバル変数のアドレス
+            char *q = skip_word(p, end);
+            if (q == p || size != 8) {
+                asm_error("value expected", p, end - p);
+            }
+            out_fixup(R_X86_64_64, find_symbol(p, q - p), 0, 8);
+            p = q;
+        }
+        p = next_item(p, end);
+    }
+}
+
+static void asm_directive(char *p, char *end) {
+    char *name = p;
+    char *q = skip_word(p, end);
+    int len = q - name;
+    p = skip_spaces(q, end);
+
+    if (equals(name, len, ".intel_syntax")) {
+        return;
+    }
+    if (equals(name, len, ".text") || equals(name, len, ".data") || equals(name, len, ".bss")) {
+        asm_section(name, q);
+        return;
+    }
+    if (equals(name, len, ".section")) {
+        asm_section(p, end);
+        return;
+    }
+
+    if (!cur_sec) {
+        switch_section(".text", 5, SHT_PROGBITS, SHF_ALLOC | SHF_EXECINSTR, 0);
+    }
+
+    if (equals(name, len, ".globl") || equals(name, len, ".global")) {
+        q = skip_word(p, end);
+        find_symbol(p, q - p)->is_global = true;
+        return;
+    }
+    if (equals(name, len, ".type")) {
+        q = skip_word(p, end);
+        AsmSymbol *sym = find_symbol(p, q - p);
+        p = next_item(q, end);
+        q = skip_word(p, end);
+        if (equals(p, q - p, "@object")) {
+            sym->type = STT_OBJECT;
+        }
+        else if (equals(p, q - p, "@function")) {
+            sym->type = STT_FUNC;
+        }
+        else {
+            asm_error("unknown symbol type", p, q - p);
+        }
+        return;
+    }
+    if (equals(name, len, ".size")) {
+        q = skip_word(p, end);
+        AsmSymbol *sym = find_symbol(p, q - p);
+        p = next_item(q, end);
+        sym->size = read_number(&p, end);
+        return;
+    }
+    if (equals(name, len, ".align") || equals(name, len, ".p2align")) {
+        uint64_t align = read_number(&p, end);
+        if (name[1] == 'p') {
+            align = 1ul << align;
+        }
+        if (align == 0 || (align & (align - 1))) {
+            asm_error("alignment must be a power of two", name, end - name);
+        }
+        if (align > cur_sec->align) {
+            cur_sec->align = align;
+        }
+        if (cur_sec->type == SHT_NOBITS) {
+            cur_sec->size = (cur_sec->size + align - 1) & ~(align - 1);
+            return;
+        }
+        // コードの中では nop で埋める
+        int fill = cur_sec->flags & SHF_EXECINSTR ? 0x90 : 0;
+        while (cur_sec->data.len % align) {
+            out_byte(fill);
+        }
+        return;
+    }
+    if (equals(name, len, ".zero")) {
+        int64_t n = read_number(&p, end);
+        if (cur_sec->type == SHT_NOBITS) {
+            cur_sec->size += n;
+            return;
+        }
+        for (int64_t i = 0; i < n; i++) {
+            out_byte(0);
+        }
+        return;
+    }
+    if (equals(name, len, ".byte")) {
+        asm_values(p, end, 1);
+        return;
+    }
+    if (equals(name, len, ".short") || equals(name, len, ".value")) {
+        asm_values(p, end, 2);
+        return;
+    }
+    if (equals(name, len, ".long")) {
+        asm_values(p, end, 4);
+        return;
+    }
+    if (equals(name, len, ".quad")) {
+        asm_values(p, end, 8);
+        return;
+    }
+    if (equals(name, len, ".ascii")) {
+        asm_string(p, end);
+        return;
+    }
+    if (equals(name, len, ".asciz") || equals(name, len, ".string")) {
+        asm_string(p, end);
+        out_byte(0);
+        return;
+    }
+    asm_error("unknown directive", name, len);
+}
+
+// ラベルを今のセクションの今の位置に定義する
+static void asm_label(char *name, int len) {
+    AsmSymbol *sym = find_symbol(name, len);
+    if (sym->sec) {
+        asm_error("symbol already defined", name, len);
+    }
+    sym->sec = cur_sec;
+    sym->value = section_size(cur_sec);
+}
+
+static void asm_line(char *p, char *end) {
+    // 9cc はコメントを行の先頭にだけ出力する
+    p = skip_spaces(p, end);
+    if (p == end || *p == '#') {
+        return;
+    }
+
+    char *q = skip_word(p, end);
+    if (q < end && *q == ':') {
+        if (!cur_sec) {
+            switch_section(".text", 5, SHT_PROGBITS, SHF_ALLOC | SHF_EXECINSTR, 0);
+        }
+        asm_label(p, q - p);
+        return;
+    }
+
+    // 行末の空白を除く
+    while (end > p && (end[-1] == ' ' || end[-1] == '\t' || end[-1] == '\r')) {
+        end--;
+    }
+
+    if (*p == '.') {
+        asm_directive(p, end);
+        return;
+    }
+    if (!cur_sec) {
+        switch_section(".text", 5, SHT_PROGBITS, SHF_ALLOC | SHF_EXECINSTR, 0);
+    }
+    asm_insn_line(p, end);
+}
+
+//
+// ELF ファイルの出力
+//
+
+// 参照されているシンボルの値を埋めるか、リンカのための再配置情報を作る
+static void resolve_fixups(AsmSection *sec) {
+    for (int i = 0; i < sec->nfixups; i++) {
+        Fixup *fix = &sec->fixups[i];
+        AsmSymbol *sym = fix->sym;
+
+        // 同じセクションのローカルなラベルへの相対アドレスは、ここで決まる
+        if (fix->type == R_X86_64_PC32 && sym->sec == sec && !sym->is_global) {
+            int64_t val = sym->value + fix->addend - fix->offset;
+            char *p = sec->data.data + fix->offset;
+            for (int j = 0; j < 4; j++) {
+                p[j] = val >> (j * 8);
+            }
+            continue;
+        }
+
+        Elf64_Rela *rela = &sec->relas[sec->nrelas++];
+        rela->r_offset = fix->offset;
+        uint32_t type = fix->type;
+        if (sym->sec && !sym->is_global) {
+            // ローカルなシンボルは、セクションのシンボルからの位置で指す
+            rela->r_info = ELF64_R_INFO(sym->sec->sym_index, type);
+            rela->r_addend = sym->value + fix->addend;
+        }
+        else {
+            // ほかのファイルで定義されうる関数は PLT を経由して呼ぶ
+            if (type == R_X86_64_PC32) {
+                type = R_X86_64_PLT32;
+            }
+            rela->r_info = ELF64_R_INFO(sym->index, type);
+            rela->r_addend = fix->addend;
+        }
+    }
+}
+
+// 文字列表に name を加え、その位置を返す
+static uint32_t add_string(Bytes *tab, char *name, int len) {
+    uint32_t off = tab->len;
+    bytes_put(tab, name, len);
+    bytes_put(tab, "", 1);
+    return off;
+}
+
+// シンボルテーブルを作る
+// ローカルなシンボルをすべてグローバルなシンボルより前に置く
+static int build_symtab(Bytes *symtab, Bytes *strtab) {
+    Elf64_Sym null = {};
+    bytes_put(symtab, &null, sizeof(null));
+    bytes_put(strtab, "", 1);
+    int nsyms = 1;
+
+    for (int i = 0; i < nsections; i++) {
+        Elf64_Sym esym = {};
+        esym.st_info = ELF64_ST_INFO(STB_LOCAL, STT_SECTION);
+        esym.st_shndx = sections[i].index;
+        bytes_put(symtab, &esym, sizeof(esym));
+        sections[i].sym_index = nsyms++;
+    }
+
+    // 1回目はローカルなシンボル、2回目はグローバルなシンボルを入れる
+    int first_global = 0;
+    for (int pass = 0; pass < 2; pass++) {
+        if (pass == 1) {
+            first_global = nsyms;
+        }
+        for (int i = 0; i < sym_capacity; i++) {
+            AsmSymbol *sym = sym_table[i];
+            if (!sym || is_local_label(sym)) {
+                continue;
+            }
+            // 未定義のシンボルはほかのファイルにあるので、グローバルとして扱う
+            bool global = sym->is_global || !sym->sec;
+            if (global != (pass == 1) || (!sym->sec && !sym->is_used)) {
+                continue;
+            }
+
+            Elf64_Sym esym = {};
+            esym.st_name = add_string(strtab, sym->name, sym->len);
+            esym.st_info = ELF64_ST_INFO(global ? STB_GLOBAL : STB_LOCAL, sym->type);
+            esym.st_shndx = sym->sec ? sym->sec->index : SHN_UNDEF;
+            esym.st_value = sym->value;
+            esym.st_size = sym->size;
+            bytes_put(symtab, &esym, sizeof(esym));
+            sym->index = nsyms++;
+        }
+    }
+    return first_global;
+}
+
+typedef struct {
+    Elf64_Shdr *shdrs;
+    int nshdrs;
+    Bytes *file;
+    Bytes *shstrtab;
+} ElfWriter;
+
+// セクションの中身をファイルに書き、セクションヘッダを作る
+static int add_shdr(ElfWriter *w, char *name, uint32_t type, uint64_t flags, void *data,
+                    uint64_t size, uint64_t align) {
+    Elf64_Shdr *sh = &w->shdrs[w->nshdrs];
+    memset(sh, 0, sizeof(*sh));
+    sh->sh_name = add_string(w->shstrtab, name, strlen(name));
+    sh->sh_type = type;
+    sh->sh_flags = flags;
+    sh->sh_addralign = align;
+    sh->sh_size = size;
+    bytes_pad(w->file, align);
+    sh->sh_offset = w->file->len;
+    if (type != SHT_NOBITS && size) {
+        bytes_put(w->file, data, size);
+    }
+    return w->nshdrs++;
+}
+
+// .L で始まるラベルはほかのファイルでは定義されないので、未定義ならエラーにする
+// write_elf が何か確保する前に調べる
+static void check_labels() {
+    for (int i = 0; i < nsections; i++) {
+        for (int j = 0; j < sections[i].nfixups; j++) {
+            AsmSymbol *sym = sections[i].fixups[j].sym;
+            if (!sym->sec && is_local_label(sym)) {
+                error("assembler: undefined label: %.*s", sym->len, sym->name);
+            }
+        }
+    }
+}
+
+static char *write_elf(size_t *len) {
+    // セクションヘッダは、空のもの、各セクション、スタックを実行可能にしない印、
+    // 再配置情報、シンボルテーブル、文字列表2つ
+    int max_shdrs = 1 + nsections * 2 + 4;
+    Elf64_Shdr *shdrs = calloc(max_shdrs, sizeof(Elf64_Shdr));
+    Bytes file = {};
+    Bytes shstrtab = {};
+    ElfWriter w = {shdrs, 1, &file, &shstrtab};
+    bytes_put(&shstrtab, "", 1);
+
+    Elf64_Ehdr eh = {};
+    bytes_put(&file, &eh, sizeof(eh));
+
+    // セクションの中身を書き出す前に、ラベルの参照を埋めて再配置情報を作る
+    // 再配置情報はシンボルを番号で指すので、先にセクションの番号とシンボルテーブルを決める
+    for (int i = 0; i < nsections; i++) {
+        sections[i].index = i + 1;
+    }
+    Bytes symtab = {};
+    Bytes strtab = {};
+    int first_global = build_symtab(&symtab, &strtab);
+    // 各セクション、.note.GNU-stack、再配置情報のあとにシンボルテーブルを置く
+    int symtab_index = nsections + 2;
+    for (int i = 0; i < nsections; i++) {
+        AsmSection *sec = &sections[i];
+        sec->relas = calloc(sec->nfixups, sizeof(Elf64_Rela));
+        resolve_fixups(sec);
+        if (sec->nrelas) {
+            symtab_index++;
+        }
+    }
+
+    for (int i = 0; i < nsections; i++) {
+        AsmSection *sec = &sections[i];
+        int idx = add_shdr(&w, sec->name, sec->type, sec->flags, sec->data.data,
+                           section_size(sec), sec->align);
+        assert(idx == sec->index);
+        shdrs[idx].sh_entsize = sec->entsize;
+    }
+    // このセクションがないと、リンカはスタックを実行可能にする
+    add_shdr(&w, ".note.GNU-stack", SHT_PROGBITS, 0, NULL, 0, 1);
+
+    for (int i = 0; i < nsections; i++) {
+        AsmSection *sec = &sections[i];
+        if (!sec->nrelas) {
+            continue;
+        }
+        char name[64];
+        snprintf(name, sizeof(name), ".rela%s", sec->name);
+        int idx = add_shdr(&w, name, SHT_RELA, SHF_INFO_LINK, sec->relas,
+                           sizeof(Elf64_Rela) * sec->nrelas, 8);
+        shdrs[idx].sh_link = symtab_index;
+        shdrs[idx].sh_info = sec->index;
+        shdrs[idx].sh_entsize = sizeof(Elf64_Rela);
+    }
+
+    int idx = add_shdr(&w, ".symtab", SHT_SYMTAB, 0, symtab.data, symtab.len, 8);
+    assert(idx == symtab_index);
+    shdrs[idx].sh_link = idx + 1;
+    shdrs[idx].sh_info = first_global;
+    shdrs[idx].sh_entsize = sizeof(Elf64_Sym);
+    add_shdr(&w, ".strtab", SHT_STRTAB, 0, strtab.data, strtab.len, 1);
+
+    // セクション名の表には自分の名前も入るので、add_shdr を使わずに名前を入れてから書き出す
+    int shstrndx = w.nshdrs++;
+    Elf64_Shdr *sh = &shdrs[shstrndx];
+    sh->sh_name = add_string(&shstrtab, ".shstrtab", 9);
+    sh->sh_type = SHT_STRTAB;
+    sh->sh_addralign = 1;
+    sh->sh_offset = file.len;
+    sh->sh_size = shstrtab.len;
+    bytes_put(&file, shstrtab.data, shstrtab.len);
+
+    bytes_pad(&file, 8);
+    uint64_t shoff = file.len;
+    bytes_put(&file, shdrs, sizeof(Elf64_Shdr) * w.nshdrs);
+
+    Elf64_Ehdr *ehdr = (Elf64_Ehdr *)file.data;
+    memcpy(ehdr->e_ident, ELFMAG, SELFMAG);
+    ehdr->e_ident[EI_CLASS] = ELFCLASS64;
+    ehdr->e_ident[EI_DATA] = ELFDATA2LSB;
+    ehdr->e_ident[EI_VERSION] = EV_CURRENT;
+    ehdr->e_ident[EI_OSABI] = ELFOSABI_NONE;
+    ehdr->e_type = ET_REL;
+    ehdr->e_machine = EM_X86_64;
+    ehdr->e_version = EV_CURRENT;
+    ehdr->e_shoff = shoff;
+    ehdr->e_ehsize = sizeof(Elf64_Ehdr);
+    ehdr->e_shentsize = sizeof(Elf64_Shdr);
+    ehdr->e_shnum = w.nshdrs;
+    ehdr->e_shstrndx = shstrndx;
+
+    free(shdrs);
+    free(shstrtab.data);
+    free(symtab.data);
+    free(strtab.data);
+    *len = file.len;
+    return file.data;
+}
+
+// 前のファイルのために確保したものを解放する
+static void reset_assembler() {
+    for (int i = 0; i < nsections; i++) {
+        free(sections[i].name);
+        free(sections[i].data.data);
+        free(sections[i].fixups);
+        free(sections[i].relas);
+    }
+    nsections = 0;
+    cur_sec = NULL;
+
+    for (int i = 0; i < sym_capacity; i++) {
+        free(sym_table[i]);
+    }
+    free(sym_table);
+    sym_table = NULL;
+    sym_capacity = 0;
+    sym_used = 0;
+}
+
+// len バイトのアセンブリ s をアセンブルし、ELF のオブジェクトファイルの中身を返す
+// s[len] は NUL でなければならず、シンボルの名前は s の中を指すので、戻るまで書き換えない
+// 返したバッファは呼び出し側が free する
+char *assemble(char *s, size_t len, size_t *obj_len) {
+    // 前の呼び出しがエラーで longjmp して抜けた場合、その状態が残っているので先に捨てる
+    reset_assembler();
+    line_num = 0;
+    char *end = s + len;
+    for (char *p = s; p < end;) {
+        char *eol = memchr(p, '\n', end - p);
+        if (!eol) {
+            eol = end;
+        }
+        line_num++;
+        asm_line(p, eol);
+        p = eol + 1;
+    }
+
+    check_labels();
+    char *obj = write_elf(obj_len);
+    reset_assembler();
+    return obj;
+}
@@ -0,0 +1,152 @@
+// コンパイラのスループットのベンチマーク
+//
+// 与えられたソースファイルをそれぞれ libninecc.a で複数回コンパイルし、
+// 最も速かった回のフェーズごとの時間と、1秒あたりのトークン数・ノード数・出力バイト数を求める
+// 表を標準エラー出力に、コミットの間で比べるための JSON を標準出力に出力する
+//
+// $ make bench
+// $ ./bench/compile -c $(git rev-parse --short HEAD) bench/work/*.c > results.json
+
+#include <string.h>
+#include "9cc.h"
+#include "ninecc.h"
+
+// 計測の繰り返し回数
+#define ITERATIONS 5
+
+typedef struct {
+    char *path;
+    size_t input_bytes;
+    size_t output_bytes;
+    long tokens;
+    long nodes;
+    double phase_time[PHASE_NUM];
+    double total;
+} Result;
+
+static char *read_all(char *path, size_t *size) {
+    FILE *fp = fopen(path, "r");
+    if (!fp) {
+        error("cannot open %s: %s", path, strerror(errno));
+    }
+    fseek(fp, 0, SEEK_END);
+    *size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+
+    char *buf = malloc(*size);
+    if (fread(buf, 1, *size, fp) != *size) {
+        error("%s: read error", path);
+    }
+    fclose(fp);
+    return buf;
+}
+
+static void print_error(void *arg, char *msg) {
+    fprintf(stderr, "%s\n", msg);
+}
+
+// ファイルを ITERATIONS 回コンパイルし、最も速かった回の結果を返す
+static Result run(char *path) {
+    Result res = {};
+    res.path = path;
+    char *src = read_all(path, &res.input_bytes);
+
+    for (int i = 0; i < ITERATIONS; i++) {
+        char *out;
+        size_t out_len;
+        double start = now();
+        if (ninecc_compile(path, src, res.input_bytes, &out, &out_len, print_error, NULL)) {
+            exit(1);
+        }
+        double total = now() - start;
+        free(out);
+
+        if (i > 0 && total >= res.total) {
+            continue;
+        }
+        res.total = total;
+        res.output_bytes = out_len;
+        res.tokens = stats.tokens;
+        res.nodes = 0;
+        for (int j = 0; j < ND_KIND_NUM; j++) {
+            res.nodes += stats.nodes[j];
+        }
+        memcpy(res.phase_time, stats.phase_time, sizeof(res.phase_time));
+    }
+
+    free(src);
+    return res;
+}
+
+static double rate(double n, double sec) {
+    return sec > 0 ? n / sec : 0;
+}
+
+static void print_table(Result *res) {
+    fprintf(stderr, "%s: %zu bytes -> %zu bytes, %.3f ms (best of %d)\n",
+            res->path, res->input_bytes, res->output_bytes, res->total * 1e3, ITERATIONS);
+    for (int i = 0; i < PHASE_NUM; i++) {
+        fprintf(stderr, "  %-10s %10.3f ms\n", phase_name(i), res->phase_time[i] * 1e3);
+    }
+    fprintf(stderr, "  tokens/s   %12.0f  (%ld tokens)\n",
+            rate(res->tokens, res->phase_time[PHASE_TOKENIZE]), res->tokens);
+    fprintf(stderr, "  nodes/s    %12.0f  (%ld nodes)\n",
+            rate(res->nodes, res->phase_time[PHASE_PARSE]), res->nodes);
+    fprintf(stderr, "  bytes/s    %12.0f  (codegen output)\n",
+            rate(res->output_bytes, res->phase_time[PHASE_CODEGEN]));
+    fprintf(stderr, "  MB/s       %12.1f  (input, whole compile)\n",
+            rate(res->input_bytes, res->total) / (1024 * 1024));
+}
+
+// ファイル名からディレクトリと拡張子を除いて、ワークロードの名前にする
+static void print_name(char *path) {
+    char *base = strrchr(path, '/');
+    base = base ? base + 1 : path;
+    char *dot = strrchr(base, '.');
+    int len = dot ? dot - base : strlen(base);
+    printf("\"%.*s\"", len, base);
+}
+
+static void print_json(Result *res) {
+    printf("{\"name\":");
+    print_name(res->path);
+    printf(",\"input_bytes\":%zu,\"output_bytes\":%zu", res->input_bytes, res->output_bytes);
+    printf(",\"tokens\":%ld,\"nodes\":%ld,\"time_ms\":{", res->tokens, res->nodes);
+    for (int i = 0; i < PHASE_NUM; i++) {
+        printf("\"%s\":%.3f,", phase_name(i), res->phase_time[i] * 1e3);
+    }
+    printf("\"total\":%.3f}", res->total * 1e3);
+    printf(",\"tokens_per_s\":%.0f", rate(res->tokens, res->phase_time[PHASE_TOKENIZE]));
+    printf(",\"nodes_per_s\":%.0f", rate(res->nodes, res->phase_time[PHASE_PARSE]));
+    printf(",\"output_bytes_per_s\":%.0f", rate(res->output_bytes, res->phase_time[PHASE_CODEGEN]));
+    printf(",\"input_bytes_per_s\":%.0f}", rate(res->input_bytes, res->total));
+}
+
+int main(int argc, char **argv) {
+    char *commit = "";
+    int i = 1;
+    if (i + 1 < argc && !strcmp(argv[i], "-c")) {
+        // 結果を比べるときのために、計測したコミットを記録する
+        commit = argv[i + 1];
+        i += 2;
+    }
+    if (i == argc) {
+        error("usage: %s [-c commit] file...", argv[0]);
+    }
+
+    // 結果を再現しやすいように、コード生成は呼び出し元のスレッドだけで行う
+    codegen_threads = 1;
+    stats.enabled = true;
+
+    printf("{\"commit\":\"%s\",\"iterations\":%d,\"workloads\":[", commit, ITERATIONS);
+    for (int first = i; i < argc; i++) {
+        Result res = run(argv[i]);
+        print_table(&res);
+        printf(i == first ? "\n  " : ",\n  ");
+        print_json(&res);
+    }
+    printf("\n]}\n");
+
+    ninecc_release();
+    return 0;
+}
@@ -0,0 +1,170 @@
+// コンパイラのベンチマーク用の入力を作る
+//
+// 指定した種類の、9cc でコンパイルできるソースコードを標準出力に出力する
+// どの種類も、それだけを大きくしたときに遅くなる部分がわかるように作る
+//
+//   functions  小さな関数をたくさん
+//   exprs      深く入れ子になった式
+//   inits      大きな構造体と配列の初期化式
+//   switch     case がたくさんある switch 文
+//   globals    たくさんのグローバル変数
+//
+// $ ./bench/gen functions > functions.c
+// $ ./bench/gen exprs 2 > exprs.c        # 2倍の大きさにする
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// 大きさの倍率
+static int scale = 1;
+
+static void gen_functions() {
+    int n = 5000 * scale;
+    for (int i = 0; i < n; i++) {
+        printf("int f%d(int a, int b) {\n", i);
+        printf("  int x = a * %d + b;\n", i);
+        printf("  int y = 0;\n");
+        printf("  for (int i = 0; i < a; i++) {\n");
+        printf("    if (x > %d)\n      y = y + x / (i + 1);\n", i);
+        printf("    else\n      y = y - i;\n");
+        printf("  }\n");
+        if (i > 0) {
+            printf("  return f%d(y, x) + y;\n", i - 1);
+        }
+        else {
+            printf("  return y;\n");
+        }
+        printf("}\n");
+    }
+    printf("int main() { return f%d(1, 2) != 0; }\n", n - 1);
+}
+
+// 深さ depth の式を出力する
+// 括弧の入れ子と二項演算子の連なりを交互に作る
+static void gen_expr(int depth) {
+    static char *ops[] = {"+", "-", "*", "&", "|", "^", "<", "==", "&&", "||"};
+    if (depth == 0) {
+        printf("a");
+        return;
+    }
+    printf("(b %s ", ops[depth % 10]);
+    gen_expr(depth - 1);
+    printf(" %s %d)", ops[(depth + 3) % 10], depth);
+}
+
+static void gen_exprs() {
+    int n = 300 * scale;
+    for (int i = 0; i < n; i++) {
+        printf("int e%d(int a, int b) {\n", i);
+        printf("  int x = ");
+        gen_expr(200);
+        printf(";\n");
+        printf("  return x ? ");
+        gen_expr(100);
+        printf(" : -x;\n");
+        printf("}\n");
+    }
+    printf("int main() { return e0(1, 2) == 0; }\n");
+}
+
+static void gen_inits() {
+    int n = 40 * scale;
+    for (int i = 0; i < n; i++) {
+        printf("struct { int x; int y; char tag; long id; } p%d[1000] = {", i);
+        for (int j = 0; j < 1000; j++) {
+            printf("%s{%d, %d, %d, %d}", j ? ", " : "", j, -j, j % 128, i * 1000 + j);
+        }
+        printf("};\n");
+
+        printf("int a%d[2000] = {", i);
+        for (int j = 0; j < 2000; j++) {
+            printf("%s%d", j ? ", " : "", j * 7 % 1000);
+        }
+        printf("};\n");
+
+        printf("char *s%d[200] = {", i);
+        for (int j = 0; j < 200; j++) {
+            printf("%s\"str%d_%d\"", j ? ", " : "", i, j);
+        }
+        printf("};\n");
+    }
+    printf("int main() { return p0[1].y + 1 + a0[0]; }\n");
+}
+
+static void gen_switch() {
+    int n = 100 * scale;
+    for (int i = 0; i < n; i++) {
+        printf("int s%d(int x) {\n", i);
+        printf("  int r = 0;\n");
+        printf("  switch (x) {\n");
+        for (int j = 0; j < 500; j++) {
+            printf("  case %d:\n    r = x * %d + %d;\n    break;\n", j, j, i);
+        }
+        printf("  default:\n    r = -1;\n");
+        printf("  }\n");
+        printf("  return r;\n");
+        printf("}\n");
+    }
+    printf("int main() { return s0(0); }\n");
+}
+
+static void gen_globals() {
+    int n = 20000 * scale;
+    for (int i = 0; i < n; i++) {
+        switch (i % 4) {
+        case 0:
+            printf("int g%d;\n", i);
+            break;
+        case 1:
+            printf("long g%d = %d;\n", i, i);
+            break;
+        case 2:
+            printf("char g%d[16];\n", i);
+            break;
+        case 3:
+            printf("int *g%d = &g%d;\n", i, i - 3);
+            break;
+        }
+    }
+
+    // 最後の関数からすべての変数を参照する
+    printf("long sum() {\n  long s = 0;\n");
+    for (int i = 0; i < n; i += 4) {
+        printf("  s = s + g%d + g%d;\n", i, i + 1);
+    }
+    printf("  return s;\n}\n");
+    printf("int main() { return sum(); }\n");
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s functions|exprs|inits|switch|globals [scale]\n", argv[0]);
+        return 1;
+    }
+    if (argc > 2) {
+        scale = atoi(argv[2]);
+    }
+
+    char *name = argv[1];
+    if (!strcmp(name, "functions")) {
+        gen_functions();
+    }
+    else if (!strcmp(name, "exprs")) {
+        gen_exprs();
+    }
+    else if (!strcmp(name, "inits")) {
+        gen_inits();
+    }
+    else if (!strcmp(name, "switch")) {
+        gen_switch();
+    }
+    else if (!strcmp(name, "globals")) {
+        gen_globals();
+    }
+    else {
+        fprintf(stderr, "unknown workload: %s\n", name);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,13 @@
+// 再帰呼び出しのフィボナッチ数
+// 関数の呼び出しと戻りのコストを計る
+
+int fib(int n) {
+  if (n < 2)
+    return n;
+  return fib(n - 1) + fib(n - 2);
+}
+
+int main() {
+  printf("%d\n", fib(32));
+  return 0;
+}
@@ -0,0 +1,29 @@
+// char * をたどる文字列のハッシュ
+// 1バイトずつの読み込みとポインタの進め方を計る
+// 符号付き整数があふれないよう、ハッシュ値は24ビットに切り詰める
+
+char text[65536];
+
+int hash(char *p) {
+  int h = 5381;
+  while (*p) {
+    h = (h * 33 ^ *p) & 16777215;
+    p++;
+  }
+  return h;
+}
+
+int main() {
+  char *alpha = "abcdefghijklmnopqrstuvwxyz0123456789";
+  for (int i = 0; i < 65535; i++)
+    text[i] = alpha[(i * 7 + (i >> 5)) & 31];
+  text[65535] = 0;
+
+  int h = 0;
+  for (int i = 0; i < 200; i++) {
+    h = h ^ hash(text + (i & 63));
+  }
+
+  printf("%d\n", h);
+  return 0;
+}
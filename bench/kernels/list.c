@@ -0,0 +1,31 @@
+// 構造体の連結リストをたどる
+// 順番をばらばらにつないだリストを何度もたどり、メンバの読み込みとポインタの追跡を計る
+
+struct node {
+  int val;
+  struct node *next;
+} nodes[65536];
+
+int main() {
+  // 線形合同法で決めた順番につなぐ
+  // 65536 を法とし、a = 1029 (4 で割ると 1 余る), c = 奇数なのですべてのノードを1周する
+  int x = 0;
+  for (int i = 0; i < 65536; i++) {
+    int y = (x * 1029 + 12345) & 65535;
+    nodes[x].val = i;
+    nodes[x].next = &nodes[y];
+    x = y;
+  }
+
+  long sum = 0;
+  for (int n = 0; n < 100; n++) {
+    struct node *p = &nodes[n];
+    for (int i = 0; i < 65536; i++) {
+      sum = sum + p->val;
+      p = p->next;
+    }
+  }
+
+  printf("%ld\n", sum);
+  return 0;
+}
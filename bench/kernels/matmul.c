@@ -0,0 +1,30 @@
+// int の配列の行列積
+// 2重の添字と、一番内側のループの積和を計る
+
+int a[128][128];
+int b[128][128];
+int c[128][128];
+
+int main() {
+  for (int i = 0; i < 128; i++)
+    for (int j = 0; j < 128; j++) {
+      a[i][j] = i + j;
+      b[i][j] = i - j;
+    }
+
+  int sum = 0;
+  for (int n = 0; n < 8; n++) {
+    for (int i = 0; i < 128; i++)
+      for (int j = 0; j < 128; j++) {
+        int s = 0;
+        for (int k = 0; k < 128; k++)
+          s += a[i][k] * b[k][j];
+        c[i][j] = s;
+      }
+    sum = sum ^ c[n][n + 1];
+    a[n][n] = a[n][n] + 1;
+  }
+
+  printf("%d\n", sum);
+  return 0;
+}
@@ -0,0 +1,28 @@
+// エラトステネスのふるい
+// char の配列への読み書きと、ループの制御を計る
+
+char composite[1000000];
+
+int sieve(int n) {
+  for (int i = 0; i < n; i++)
+    composite[i] = 0;
+
+  int count = 0;
+  for (int i = 2; i < n; i++) {
+    if (composite[i])
+      continue;
+    count++;
+    for (int j = i + i; j < n; j += i)
+      composite[j] = 1;
+  }
+  return count;
+}
+
+int main() {
+  int count = 0;
+  for (int i = 0; i < 10; i++)
+    count = sieve(1000000);
+
+  printf("%d\n", count);
+  return 0;
+}
@@ -0,0 +1,67 @@
+// switch で遷移する状態機械
+// 入力を1文字ずつ読んで、数値・識別子・空白・記号を数える字句解析器のような処理を計る
+
+char input[65536];
+
+int main() {
+  char *src = "foo = bar + 123 * (baz42 - 7);\n  if (x1 < 99) y = y + 1;\n";
+  int len = 0;
+  while (src[len])
+    len++;
+  int j = 0;
+  for (int i = 0; i < 65535; i++) {
+    input[i] = src[j];
+    if (++j == len)
+      j = 0;
+  }
+  input[65535] = 0;
+
+  int idents = 0;
+  int numbers = 0;
+  int puncts = 0;
+  for (int n = 0; n < 50; n++) {
+    int state = 0;
+    for (char *p = input; *p; p++) {
+      int c = *p;
+      int cls = 3;
+      if ('a' <= c && c <= 'z')
+        cls = 1;
+      else if ('0' <= c && c <= '9')
+        cls = 2;
+      else if (c == ' ' || c == '\n')
+        cls = 0;
+
+      // 9cc の case は直後の1文を実行すると switch を抜けるので、複数の文はブロックにまとめる
+      switch (state) {
+      case 0:
+        switch (cls) {
+        case 0: break;
+        case 1: { state = 1; break; }
+        case 2: { state = 2; break; }
+        default: { puncts++; break; }
+        }
+        break;
+      case 1:
+        switch (cls) {
+        case 1:
+        case 2:
+          break;
+        case 0: { idents++; state = 0; break; }
+        default: { idents++; puncts++; state = 0; break; }
+        }
+        break;
+      case 2:
+        switch (cls) {
+        case 2: break;
+        case 1: { state = 1; break; }
+        case 0: { numbers++; state = 0; break; }
+        default: { numbers++; puncts++; state = 0; break; }
+        }
+        break;
+      }
+    }
+  }
+
+  printf("%d %d %d\n", idents, numbers, puncts);
+  return 0;
+}
@@ -0,0 +1,184 @@
+// 9cc が生成したコードの実行速度のベンチマーク
+//
+// bench/kernels の各カーネルを 9cc と、比較のためにシステムの cc -O0 / -O2 でビルドしたものを
+// それぞれ複数回実行し、最も速かった回の実行時間と、実行した命令数を出力する
+// 命令数はハードウェアのカウンタ(perf_event_open)で数えるので、使えない環境では -1 になる
+// 出力が cc でビルドしたものと違えば、生成したコードが間違っているのでエラーにする
+//
+// 表を標準エラー出力に、コミットの間で比べるための JSON を標準出力に出力する
+//
+// $ make bench-runtime
+// $ ./bench/runtime -c $(git rev-parse --short HEAD) matmul fib > runtime.json
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <linux/perf_event.h>
+
+// 計測の繰り返し回数
+#define ITERATIONS 3
+// カーネルの出力の長さの上限
+#define MAX_OUTPUT 4096
+
+// 比べるビルドの種類、bench/kernels/out/<カーネル>-<種類> にビルドしたものを置く
+static char *variants[] = {"9cc", "O0", "O2"};
+#define NUM_VARIANTS (sizeof(variants) / sizeof(*variants))
+
+typedef struct {
+    double time;        // 最も速かった回の実行時間(秒)
+    long insns;         // その回に実行した命令の数、数えられなければ -1
+    char output[MAX_OUTPUT];
+} Result;
+
+static double now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void die(char *fmt, char *arg) {
+    fprintf(stderr, fmt, arg, strerror(errno));
+    fprintf(stderr, "\n");
+    exit(1);
+}
+
+// 子プロセスのユーザ空間で実行した命令を数えるカウンタを開く
+// exec した時点で数え始める
+static int open_counter(pid_t pid) {
+    struct perf_event_attr attr = {};
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+    attr.disabled = 1;
+    attr.enable_on_exec = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return syscall(SYS_perf_event_open, &attr, pid, -1, -1, 0);
+}
+
+// path を1回実行し、標準出力を output に読み込む
+static void run_once(char *path, double *time, long *insns, char *output) {
+    int out[2];
+    int go[2];
+    if (pipe(out) < 0 || pipe(go) < 0) {
+        die("%s: pipe: %s", path);
+    }
+
+    // カウンタを開いてから exec させるため、子プロセスは go が閉じられるまで待つ
+    pid_t pid = fork();
+    if (pid < 0) {
+        die("%s: fork: %s", path);
+    }
+    if (pid == 0) {
+        char c;
+        close(go[1]);
+        read(go[0], &c, 1);
+        dup2(out[1], STDOUT_FILENO);
+        close(out[0]);
+        execl(path, path, (char *)NULL);
+        _exit(127);
+    }
+
+    close(out[1]);
+    close(go[0]);
+    int fd = open_counter(pid);
+
+    double start = now();
+    close(go[1]);
+
+    int len = 0;
+    int n;
+    while ((n = read(out[0], output + len, MAX_OUTPUT - 1 - len)) > 0) {
+        len += n;
+    }
+    output[len] = '\0';
+    close(out[0]);
+
+    int status;
+    waitpid(pid, &status, 0);
+    *time = now() - start;
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        fprintf(stderr, "%s: exited abnormally\n", path);
+        exit(1);
+    }
+
+    *insns = -1;
+    if (fd >= 0) {
+        long count;
+        if (read(fd, &count, sizeof(count)) == sizeof(count)) {
+            *insns = count;
+        }
+        close(fd);
+    }
+}
+
+static Result run(char *kernel, char *variant) {
+    char path[1024];
+    snprintf(path, sizeof(path), "bench/kernels/out/%s-%s", kernel, variant);
+
+    Result res = {};
+    for (int i = 0; i < ITERATIONS; i++) {
+        double time;
+        long insns;
+        run_once(path, &time, &insns, res.output);
+        if (i == 0 || time < res.time) {
+            res.time = time;
+            res.insns = insns;
+        }
+    }
+    return res;
+}
+
+int main(int argc, char **argv) {
+    char *commit = "";
+    int i = 1;
+    if (i + 1 < argc && !strcmp(argv[i], "-c")) {
+        // 結果を比べるときのために、計測したコミットを記録する
+        commit = argv[i + 1];
+        i += 2;
+    }
+    if (i == argc) {
+        fprintf(stderr, "usage: %s [-c commit] kernel...\n", argv[0]);
+        return 1;
+    }
+
+    bool ok = true;
+    fprintf(stderr, "%-8s %-4s %10s %14s %8s\n", "kernel", "cc", "time(ms)", "instructions", "vs -O2");
+    printf("{\"commit\":\"%s\",\"iterations\":%d,\"kernels\":[", commit, ITERATIONS);
+    for (int first = i; i < argc; i++) {
+        char *kernel = argv[i];
+        Result res[NUM_VARIANTS];
+        for (int j = 0; j < NUM_VARIANTS; j++) {
+            res[j] = run(kernel, variants[j]);
+        }
+
+        // 最後の種類(cc -O2)の出力を正しいものとする
+        Result *ref = &res[NUM_VARIANTS - 1];
+        bool same = true;
+        for (int j = 0; j < NUM_VARIANTS; j++) {
+            if (strcmp(res[j].output, ref->output)) {
+                fprintf(stderr, "%s-%s: wrong output: %s", kernel, variants[j], res[j].output);
+                same = false;
+            }
+            fprintf(stderr, "%-8s %-4s %10.2f %14ld %7.2fx\n", kernel, variants[j],
+                    res[j].time * 1e3, res[j].insns, res[j].time / ref->time);
+        }
+        ok = ok && same;
+
+        printf(i == first ? "\n  " : ",\n  ");
+        printf("{\"name\":\"%s\",\"ok\":%s", kernel, same ? "true" : "false");
+        for (int j = 0; j < NUM_VARIANTS; j++) {
+            printf(",\"%s\":{\"time_ms\":%.3f,\"instructions\":%ld}",
+                   variants[j], res[j].time * 1e3, res[j].insns);
+        }
+        printf("}");
+    }
+    printf("\n]}\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,168 @@
+// トークナイザのマイクロベンチマーク
+//
+// 与えられたソースファイルを繰り返し連結して数 MB の入力を作り、
+// tokenize() を複数回実行して1秒あたりのトークン数を出力する
+// 文字の並びを読み飛ばす関数(scan.c)の実装ごとに計測し、
+// さらにそれぞれの関数だけを大きな入力に対して動かしたときの GB/s を出力する
+//
+// $ make bench-tokenize
+// $ ./bench/tokenize tests examples/nqueen.c
+
+#include <string.h>
+#include "9cc.h"
+
+// 入力の最小サイズ
+#define INPUT_SIZE (8 * 1024 * 1024)
+// 計測の繰り返し回数
+#define ITERATIONS 5
+// 読み飛ばす関数だけを計測するときの入力のサイズ
+#define SCAN_SIZE (64 * 1024 * 1024)
+
+static char *impl_names[] = {"scalar", "sse2", "avx2"};
+#define NUM_IMPLS (sizeof(impl_names) / sizeof(*impl_names))
+
+static char *read_all(char *path, long *size) {
+    FILE *fp = fopen(path, "r");
+    if (!fp) {
+        error("cannot open %s: %s", path, strerror(errno));
+    }
+    fseek(fp, 0, SEEK_END);
+    *size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+
+    char *buf = malloc(*size);
+    if (fread(buf, 1, *size, fp) != *size) {
+        error("%s: read error", path);
+    }
+    fclose(fp);
+    return buf;
+}
+
+// user_input を最後までトークナイズする時間を ITERATIONS 回計り、最も速かったものを返す
+static double tokenize_time(long *ntokens) {
+    double best = 0;
+    for (int i = 0; i < ITERATIONS; i++) {
+        arena_reset(ARENA_TOKEN);
+
+        // トークナイザは読み進めたときに字句解析するので、最後まで読み進める時間を計る
+        // パーサと同じく一定数ごとに読み終えたトークンを解放し、使用メモリを一定に保つ
+        double start = now();
+        *ntokens = 0;
+        for (token = tokenize(); token->kind != TK_EOF; token = next_token(token)) {
+            if (++*ntokens % 4096 == 0) {
+                release_tokens();
+            }
+        }
+        double elapsed = now() - start;
+        if (best == 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+    return best;
+}
+
+// 読み飛ばす関数を1つずつ、SCAN_SIZE バイトの同じ種類の文字の並びに対して動かす
+// 関数の名前と、並びに使う文字
+// ScanImpl の関数と同じ順に並べる
+typedef struct {
+    char *name;
+    char fill;
+} Kernel;
+
+static Kernel kernels[] = {
+    {"space", ' '},
+    {"ident", 'a'},
+    {"digits", '7'},
+    {"line", 'x'},
+    {"comment", 'x'},
+    {"string", 'x'},
+};
+#define NUM_KERNELS (sizeof(kernels) / sizeof(*kernels))
+
+static void bench_kernels() {
+    // 並びの最後は NUL で止める
+    char *buf = malloc(SCAN_SIZE + 1);
+    buf[SCAN_SIZE] = '\0';
+
+    printf("%-8s", "GB/s");
+    for (int i = 0; i < NUM_IMPLS; i++) {
+        printf(" %8s", impl_names[i]);
+    }
+    printf("\n");
+
+    for (int k = 0; k < NUM_KERNELS; k++) {
+        memset(buf, kernels[k].fill, SCAN_SIZE);
+        printf("%-8s", kernels[k].name);
+        for (int i = 0; i < NUM_IMPLS; i++) {
+            if (!scan_select(impl_names[i])) {
+                printf(" %8s", "-");
+                continue;
+            }
+            char *(*fns[NUM_KERNELS])(char *) = {
+                scan.skip_space, scan.skip_ident, scan.skip_digits,
+                scan.find_newline, scan.find_star, scan.find_string_end,
+            };
+            char *(*fn)(char *) = fns[k];
+            double best = 0;
+            for (int j = 0; j < ITERATIONS; j++) {
+                double start = now();
+                char *end = fn(buf);
+                double elapsed = now() - start;
+                if (end != buf + SCAN_SIZE) {
+                    error("%s: %s stopped at %ld", impl_names[i], kernels[k].name, end - buf);
+                }
+                if (best == 0 || elapsed < best) {
+                    best = elapsed;
+                }
+            }
+            printf(" %8.2f", SCAN_SIZE / best / 1e9);
+        }
+        printf("\n");
+    }
+    free(buf);
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        error("usage: %s file...", argv[0]);
+    }
+
+    // 全ファイルを連結したものを1単位として、INPUT_SIZE を超えるまで繰り返す
+    long unit_size = 0;
+    char *unit = NULL;
+    for (int i = 1; i < argc; i++) {
+        long size;
+        char *buf = read_all(argv[i], &size);
+        unit = realloc(unit, unit_size + size + 1);
+        memcpy(unit + unit_size, buf, size);
+        unit_size += size;
+        unit[unit_size++] = '\n';
+        free(buf);
+    }
+
+    long size = 0;
+    user_input = malloc(INPUT_SIZE + unit_size + 1);
+    while (size < INPUT_SIZE) {
+        memcpy(user_input + size, unit, unit_size);
+        size += unit_size;
+    }
+    user_input[size] = '\0';
+
+    printf("input: %ld bytes\n", size);
+    printf("%-8s %10s %14s %10s\n", "scan", "time(ms)", "tokens/s", "MB/s");
+    for (int i = 0; i < NUM_IMPLS; i++) {
+        if (!scan_select(impl_names[i])) {
+            continue;
+        }
+        long ntokens;
+        double best = tokenize_time(&ntokens);
+        printf("%-8s %10.3f %14.0f %10.1f\n", impl_names[i], best * 1e3,
+               ntokens / best, size / best / (1024 * 1024));
+    }
+    printf("\n");
+
+    bench_kernels();
+    printf("\n");
+    arena_report(stdout);
+    return 0;
+}
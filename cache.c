@@ -0,0 +1,194 @@
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include "9cc.h"
+
+// 関数ごとに生成したアセンブリのキャッシュ
+//
+// 関数のコードは、その関数定義のソースと、それより前にあるグローバルな宣言だけで決まる
+// (ほかの関数の本体は影響しない)
+// そこで、この2つとコンパイラ自身から作ったキーで、生成したコードをディレクトリに保存しておき、
+// 次のコンパイルで同じキーの関数があれば、型付けもコード生成もせずにそのまま使う
+//
+// キャッシュのファイルは次の形をしている
+//   "9cc-cache\n"
+//   前にある宣言のハッシュ(8バイト)
+//   関数定義のソースの長さ(8バイト)、ソース
+//   命令の数(8バイト)、アセンブリの長さ(8バイト)、アセンブリ
+// ハッシュが衝突しても違うコードを使わないよう、読んだときにソースを比べる
+
+// キャッシュを置くディレクトリ、NULL ならキャッシュを使わない
+// コンパイルを始める前に main で設定し、以降は書き換えない
+char *cache_dir;
+
+#define CACHE_MAGIC "9cc-cache\n"
+
+// FNV-1a
+uint64_t hash_bytes(uint64_t h, char *p, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        h = (h ^ (unsigned char)p[i]) * 0x100000001b3ul;
+    }
+    return h;
+}
+
+static uint64_t hash_u64(uint64_t h, uint64_t val) {
+    return hash_bytes(h, (char *)&val, sizeof(val));
+}
+
+// コンパイラが変わったら同じソースでも違うコードになるので、実行ファイルをキーに含める
+// 中身を読むと遅いので、大きさと更新時刻で区別する
+static uint64_t compiler_hash() {
+    uint64_t h = CACHE_HASH_INIT;
+    struct stat st;
+    if (stat("/proc/self/exe", &st) == 0) {
+        h = hash_u64(h, st.st_ino);
+        h = hash_u64(h, st.st_size);
+        h = hash_u64(h, st.st_mtim.tv_sec);
+        h = hash_u64(h, st.st_mtim.tv_nsec);
+    }
+    return h;
+}
+
+static char *cache_path(uint64_t key, char *suffix) {
+    int len = snprintf(NULL, 0, "%s/%016lx%s", cache_dir, key, suffix);
+    char *buf = arena_alloc(ARENA_AST, len + 1);
+    sprintf(buf, "%s/%016lx%s", cache_dir, key, suffix);
+    return buf;
+}
+
+static bool write_full(int fd, void *buf, size_t len) {
+    char *p = buf;
+    while (len > 0) {
+        ssize_t n = write(fd, p, len);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        p += n;
+        len -= n;
+    }
+    return true;
+}
+
+// 先頭から 8 バイトの数を読み進める
+static uint64_t read_u64(char **p) {
+    uint64_t val;
+    memcpy(&val, *p, 8);
+    *p += 8;
+    return val;
+}
+
+// キャッシュのファイルの中身を調べ、fn のものであればコードを fn->cached に入れる
+// 壊れたファイルや別の関数のファイルは、キャッシュにないものとして扱う
+static bool parse_entry(Function *fn, char *p, size_t size) {
+    char *end = p + size;
+    uint64_t src_len = fn->src_end - fn->src;
+    int magic_len = sizeof(CACHE_MAGIC) - 1;
+    if (size < magic_len + 16 + src_len + 16 || memcmp(p, CACHE_MAGIC, magic_len)) {
+        return false;
+    }
+    p += magic_len;
+
+    if (read_u64(&p) != fn->deps || read_u64(&p) != src_len || memcmp(p, fn->src, src_len)) {
+        return false;
+    }
+    p += src_len;
+
+    uint64_t insns = read_u64(&p);
+    uint64_t code_len = read_u64(&p);
+    if (code_len != end - p) {
+        return false;
+    }
+
+    fn->cached = p;
+    fn->cached_len = code_len;
+    fn->cached_insns = insns;
+    return true;
+}
+
+static bool read_full(int fd, void *buf, size_t len) {
+    char *p = buf;
+    while (len > 0) {
+        ssize_t n = read(fd, p, len);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        p += n;
+        len -= n;
+    }
+    return true;
+}
+
+// キャッシュのファイルを大きさを調べてから読み込む
+// read は要求より短く返ることがあるので、最後まで読めたかを確かめる
+static bool load(Function *fn, char *path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    bool ok = false;
+    struct stat st;
+    if (fstat(fd, &st) == 0) {
+        char *buf = arena_alloc(ARENA_AST, st.st_size);
+        ok = read_full(fd, buf, st.st_size) && parse_entry(fn, buf, st.st_size);
+    }
+    close(fd);
+    return ok;
+}
+
+// 各関数のキャッシュを探し、見つかったものは fn->cached にコードを入れる
+// 見つからなかった関数は、コードを生成したあと cache_store で保存する
+void cache_lookup(Program *prog) {
+    if (!cache_dir) {
+        return;
+    }
+
+    // 見つからなかった関数のコードは cache_store で保存するので、ここでディレクトリを作っておく
+    mkdir(cache_dir, 0777);
+
+    uint64_t compiler = compiler_hash();
+    for (Function *fn = prog->fns; fn; fn = fn->next) {
+        uint64_t key = hash_u64(compiler, fn->deps);
+        fn->cache_key = hash_bytes(key, fn->src, fn->src_end - fn->src);
+        if (load(fn, cache_path(fn->cache_key, ""))) {
+            stats.cache_hits++;
+        }
+        else {
+            stats.cache_misses++;
+        }
+    }
+}
+
+// fn のために生成したコードをキャッシュに保存する
+// 別のプロセスが同じファイルを同時に読み書きしても壊れないよう、
+// 一時ファイルに書いてから rename する
+// 保存できなくてもコンパイルは続けられるので、失敗は無視する
+// ディレクトリは cache_lookup で作ってある
+void cache_store(Function *fn, char *code, size_t code_len, long insns) {
+    char suffix[64];
+    snprintf(suffix, sizeof(suffix), ".tmp.%d.%lx", getpid(), (unsigned long)pthread_self());
+    char *tmp = cache_path(fn->cache_key, suffix);
+    int fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return;
+    }
+
+    uint64_t src_len = fn->src_end - fn->src;
+    uint64_t n = insns;
+    uint64_t len = code_len;
+    bool ok = write_full(fd, CACHE_MAGIC, sizeof(CACHE_MAGIC) - 1) &&
+              write_full(fd, &fn->deps, 8) &&
+              write_full(fd, &src_len, 8) && write_full(fd, fn->src, src_len) &&
+              write_full(fd, &n, 8) && write_full(fd, &len, 8) && write_full(fd, code, code_len);
+    if (close(fd) < 0 || !ok || rename(tmp, cache_path(fn->cache_key, "")) < 0) {
+        unlink(tmp);
+    }
+}
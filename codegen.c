@@ -1,3 +1,7 @@
+#include <pthread.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <sys/sysinfo.h>
 #include "9cc.h"
 #ifdef DEBUG
 #include "utility.h"
@@ -5,13 +9,20 @@
 
 void gen(Node *node);
 
-// ユニークなラベルを作るための連番
-static int labelseq = 1;
-static int brkseq;
-static int contseq;
+// 関数ごとのコード生成に使うスレッドの数、0 なら CPU の数に合わせる
+// コンパイルするスレッドごとに設定できる
+_Thread_local int codegen_threads;
+
+// 関数は複数のスレッドで並行してコード生成するので、以下の状態はスレッドごとに持つ
+
+// 関数の中でユニークなラベルを作るための連番
+// ラベル名には関数名を含めるので、連番は関数ごとに 1 から始めてよい
+static _Thread_local int labelseq;
+static _Thread_local int brkseq;
+static _Thread_local int contseq;
 
 // 今コード生成している関数の名称
-static char *funcname;
+static _Thread_local char *funcname;
 
 // System V AMD64 ABI で、関数呼び出し時の引数を指定するのに使うレジスタ
 char *argreg1[] = { "dil", "sil",  "dl",  "cl", "r8b", "r9b" };
@@ -23,111 +34,111 @@ char *argreg8[] = { "rdi", "rsi", "rdx", "rcx",  "r8",  "r9" };
 // アドレスを取り出し、代わりにアドレスが指す値をスタックトップにいれる
 // x86 では扱うデータのバイト数によってレジスタが異なる
 void load(Type *ty) {
-    printf("  pop rax\n");
+    emit("  pop rax\n");
 
     int sz = size_of(ty, NULL);
     if (sz == 1) {
         // rax が指すアドレスから1バイト読んで rax にいれる
-        printf("  movsx rax, byte ptr [rax]\n");
+        emit("  movsx rax, byte ptr [rax]\n");
     }
     else if (sz == 2) {
-        printf("  movsx rax, word ptr [rax]\n");
+        emit("  movsx rax, word ptr [rax]\n");
     }
     else if (sz == 4) {
         // rax が指すアドレスから4バイト読んで rax にいれる
-        printf("  movsxd rax, dword ptr [rax]\n");
+        emit("  movsxd rax, dword ptr [rax]\n");
     }
     else {
         assert(sz == 8);
         // rax が指すアドレスから8バイト読んで rax にいれる
-        printf("  mov rax, [rax]\n");
+        emit("  mov rax, [rax]\n");
     }
 
-    printf("  push rax\n");
+    emit("  push rax\n");
 }
 
 // スタックトップに値、その次にアドレスが入っている前提で
 // アドレスに値を入れ、値を再度スタックトップに入れなおす
 void store(Type *ty) {
     // 右辺の計算結果を rdi に取り出し
-    printf("  pop rdi\n");
+    emit("  pop rdi\n");
     // 左辺の変数のアドレスを rax に取り出し
-    printf("  pop rax\n");
+    emit("  pop rax\n");
 
     // C ではブールはゼロか非ゼロかだけで判定するが
     // 処理のしやすさのためここで 0 か 1 に丸める
     if (ty->kind == TY_BOOL) {
         // cmp は eflag レジスタの ZF(zero flag) ビットを更新する
-        printf("  cmp rdi, 0\n");
+        emit("  cmp rdi, 0\n");
         // ZF が1でないとき(rdi と 0 が等しくないとき) dil を1にする
-        printf("  setne dil\n");
+        emit("  setne dil\n");
         // dil は1バイトなので movzb で rdi(8バイト)に拡張する
-        printf("  movzb rdi, dil\n");
+        emit("  movzb rdi, dil\n");
     }
 
     int sz = size_of(ty, NULL);
     // 左辺の変数のメモリ領域に右辺の計算結果を入れる
     if (sz == 1) {
         // dil は rdi の最下位1バイト
-        printf("  mov [rax], dil\n");
+        emit("  mov [rax], dil\n");
     }
     else if (sz == 2) {
-        printf("  mov [rax], di\n");
+        emit("  mov [rax], di\n");
     }
     else if (sz == 4) {
-        printf("  mov [rax], edi\n");
+        emit("  mov [rax], edi\n");
     }
     else {
         assert(sz == 8);
-        printf("  mov [rax], rdi\n");
+        emit("  mov [rax], rdi\n");
     }
 
     // 代入式は右辺の値を返すので、再び rdi をスタックトップにいれる
-    printf("  push rdi\n");
+    emit("  push rdi\n");
 }
 
 // スタックから値を取り出して、指定された型に丸めて、スタックに戻す
 void truncate(Type *ty) {
-    printf("  pop rax\n");
+    emit("  pop rax\n");
 
     if (ty->kind == TY_BOOL) {
         // bool へのキャストの場合、単に 0 と比較して、0  じゃなかったら 1 をセットする　
-        printf("  cmp rax, 0\n");
-        printf("  setne al\n");
+        emit("  cmp rax, 0\n");
+        emit("  setne al\n");
     }
 
     int sz = size_of(ty, NULL);
     if (sz == 1) {
-        printf("  movsx rax, al\n");
+        emit("  movsx rax, al\n");
     }
     else if (sz == 2) {
-        printf("  movsx eax, ax\n");
+        emit("  movsx eax, ax\n");
     }
     else if (sz == 4) {
-        printf("  movsxd rax, eax\n");
+        emit("  movsxd rax, eax\n");
     }
 
     // 最後にスタックトップに値を戻す
-    printf("  push rax\n");
+    emit("  push rax\n");
 }
 
 // スタックトップにある値をインクリメントして置き換える
 void inc(Node *node) {
     int sz = node->ty->base ? size_of(node->ty->base, node->tok) : 1;
-    printf("  pop rax\n");
+    emit("  pop rax\n");
     // ty->base に値が入っているということは、この型は基本型ではなく配列やポインタなど
     // この場合は単純に1を足すのではなく変数の型に応じて足さないといけない
     // アドレスに対する加減算と同じ
-    printf("  add rax, %d\n", sz);
-    printf("  push rax\n");
+    emit_num("  add rax, ", sz);
+    emit("  push rax\n");
 }
 
 // スタックトップにある値をデクリメントして置き換える
 void dec(Node *node) {
     int sz = node->ty->base ? size_of(node->ty->base, node->tok) : 1;
-    printf("  pop rax\n");
-    printf("  sub rax, %d\n", sz);
-    printf("  push rax\n");
+    emit("  pop rax\n");
+    emit_num("  sub rax, ", sz);
+    emit("  push rax\n");
 }
 
 // 変数のオフセットを計算してスタックトップに置く
@@ -137,27 +148,27 @@ void gen_addr(Node *node) {
         Var *var = node->var;
 
         if (var->is_local) {
-            printf("  mov rax, rbp\n");
-            printf("  sub rax, %d\n", var->offset);
-            printf("  push rax\n");
+            emit("  mov rax, rbp\n");
+            emit_num("  sub rax, ", var->offset);
+            emit("  push rax\n");
         }
         else {
-            printf("  push offset %s\n", var->name);
+            emit_sym("  push offset ", var->name);
         }
         return;
     }
     case ND_DEREF:
         // 代入文の左辺にデリファレンスがあった場合
-        gen(node->lhs);
+        gen(node_at(node->lhs));
         return;
     case ND_MEMBER:
         // 代入文の左辺に構造体メンバアクセスがあった場合
         // 構造体のアドレスをスタックトップに置く
-        gen_addr(node->lhs);
-        printf("  pop rax\n");
+        gen_addr(node_at(node->lhs));
+        emit("  pop rax\n");
         // 構造体メンバのオフセットを追加してスタックトップに置き直す
-        printf("  add rax, %d\n", node->member->offset);
-        printf("  push rax\n");
+        emit_num("  add rax, ", node->member->offset);
+        emit("  push rax\n");
         return;
     }
 
@@ -186,25 +197,25 @@ void gen(Node *node) {
     case ND_NUM:
         // 数字には int の場合と long の場合がある
         if (node->val == (int)node->val) {
-            printf("  push %ld\n", node->val);
+            emit_num("  push ", node->val);
         }
         else {
             // 64bit の即値の場合は mov ではなく movabs を使う
-            printf("  movabs rax, %ld\n", node->val);
-            printf("  push rax\n");
+            emit_num("  movabs rax, ", node->val);
+            emit("  push rax\n");
         }
         return;
     case ND_EXPR_STMT:
         // 代入されない文の場合、スタックトップに入った戻り値は捨てないといけない
-        gen(node->lhs);
-        printf("  add rsp, 8\n");
+        gen(node_at(node->lhs));
+        emit("  add rsp, 8\n");
         return;
     case ND_FUNCALL: {
         // 引数を第一引数から順番に評価し、結果を対応するレジスタにセットする
         // 実行後は第一引数の評価結果がスタックの深いところに入っている
         // 最後の引数の評価結果がスタックトップに入っている
         int nargs = 0;
-        for (Node *arg = node->args; arg; arg = arg->next) {
+        for (Node *arg = node_at(node->args); arg; arg = node_at(arg->next)) {
             gen(arg);
             nargs++;
         }
@@ -213,7 +224,7 @@ void gen(Node *node) {
         // 後ろの引数から順番に pop してレジスタに入れていく
         // 引数の型が char でも int と同じレジスタを使う
         for (int i = nargs - 1; i >= 0; i--) {
-            printf("  pop %s\n", argreg8[i]);
+            emit_sym("  pop ", argreg8[i]);
         }
 
         // 関数を呼び出す前に、ABI に準拠するため RSP を16の倍数にしないといけない
@@ -221,27 +232,27 @@ void gen(Node *node) {
         int seq = labelseq++;
         // RSP と 15 のビット論理積を取り、ゼロなら16の倍数になっているのでそのまま
         // そうでなければ調整が必要
-        printf("  mov rax, rsp\n");
-        printf("  and rax, 15\n");
-        printf("  jnz .Lcall%d\n", seq);
-        printf("  mov rax, 0\n");
+        emit("  mov rax, rsp\n");
+        emit("  and rax, 15\n");
+        emit_ref("  jnz .Lcall.", funcname, seq);
+        emit("  mov rax, 0\n");
         // 特に調整せずそのまま関数呼び出し
-        printf("  call %s\n", node->funcname);
-        printf("  jmp .Lend%d\n", seq);
+        emit_sym("  call ", node->funcname);
+        emit_ref("  jmp .Lend.", funcname, seq);
 
         // 16の倍数になっていない場合は 8 バイトずらす(RSP は8バイト単位で動くため)
-        printf(".Lcall%d:\n", seq);
-        printf("  sub rsp, 8\n");
-        printf("  mov rax, 0\n");
-        printf("  call %s\n", node->funcname);
+        emit_label(".Lcall.", funcname, seq);
+        emit("  sub rsp, 8\n");
+        emit("  mov rax, 0\n");
+        emit_sym("  call ", node->funcname);
         // この場合は RSP を調整した8バイトだけ戻す
-        printf("  add rsp, 8\n");
-        printf(".Lend%d:\n", seq);
+        emit("  add rsp, 8\n");
+        emit_label(".Lend.", funcname, seq);
 
         // 戻り値は rax に入って戻って来る
         // 関数呼び出しの結果は関数の戻り値なので、それをスタックトップにいれる
         // void 関数の場合でも rax の値(不定値)がスタックトップに入る
-        printf("  push rax\n");
+        emit("  push rax\n");
         // もし戻り値が変数に代入されていたら、void 型の値を作ろうとしたのでエラーになる
         // 代入などがなくただ関数を呼び出すためだったら EXPR_STMT ということになり
         // その場合は EXPR_STMT で生成されるコードで値を捨てるので問題なし
@@ -255,100 +266,100 @@ void gen(Node *node) {
     }
     case ND_RETURN:
         // return する値を計算しスタックトップに入れる
-        gen(node->lhs);
-        printf("  pop rax\n");
+        gen(node_at(node->lhs));
+        emit("  pop rax\n");
         // 関数を抜ける前の共通処理(epilogue)があるので直接 ret せずジャンプ
-        printf("  jmp .Lreturn.%s\n", funcname);
+        emit_sym("  jmp .Lreturn.", funcname);
         return;
     case ND_NOT:
         // 値を計算しスタックトップに置く
-        gen(node->lhs);
-        printf("  pop rax\n");
-        printf("  cmp rax, 0\n");
+        gen(node_at(node->lhs));
+        emit("  pop rax\n");
+        emit("  cmp rax, 0\n");
         // sete は直前の cmp の結果が equal だったら al に 1 を書き込む
-        printf("  sete al\n");
+        emit("  sete al\n");
         // 64ビットに拡張した上でスタックトップに置く
-        printf("  movzb rax, al\n");
-        printf("  push rax\n");
+        emit("  movzb rax, al\n");
+        emit("  push rax\n");
         return;
     case ND_BITNOT:
-        gen(node->lhs);
-        printf("  pop rax\n");
-        printf("  not rax\n");
-        printf("  push rax\n");
+        gen(node_at(node->lhs));
+        emit("  pop rax\n");
+        emit("  not rax\n");
+        emit("  push rax\n");
         return;
     case ND_LOGAND: {
         int seq = labelseq++;
         // && は短絡の可能性がある
         // まず左側の式を計算しスタックトップに置く
-        gen(node->lhs);
+        gen(node_at(node->lhs));
         // 左側の式の値が 0 かどうかを判定
-        printf("  pop rax\n");
-        printf("  cmp rax, 0\n");
+        emit("  pop rax\n");
+        emit("  cmp rax, 0\n");
         // 0 の場合(すなわち右側の式を評価する必要がなくなったとき)はジャンプ
-        printf("  je  .Lfalse%d\n", seq);
+        emit_ref("  je  .Lfalse.", funcname, seq);
         // 右側の式でも同様の処理を実施
-        gen(node->rhs);
-        printf("  pop rax\n");
-        printf("  cmp rax, 0\n");
-        printf("  je  .Lfalse%d\n", seq);
+        gen(node_at(node->rhs));
+        emit("  pop rax\n");
+        emit("  cmp rax, 0\n");
+        emit_ref("  je  .Lfalse.", funcname, seq);
         // どちらも 0 でなかった場合は 1 を push して終了
-        printf("  push 1\n");
-        printf("  jmp .Lend%d\n", seq);
+        emit("  push 1\n");
+        emit_ref("  jmp .Lend.", funcname, seq);
         // 0 になった場合のジャンプ先をここに出力
-        printf(".Lfalse%d:\n", seq);
-        printf("  push 0\n");
+        emit_label(".Lfalse.", funcname, seq);
+        emit("  push 0\n");
         // 出口にもラベル
-        printf(".Lend%d:\n", seq);
+        emit_label(".Lend.", funcname, seq);
         return;
     }
     case ND_LOGOR: {
         // LOGAND の場合と同じだが、1 のとき短絡する
         int seq = labelseq++;
-        gen(node->lhs);
-        printf("  pop rax\n");
-        printf("  cmp rax, 0\n");
-        printf("  jne .Ltrue%d\n", seq);
-        gen(node->rhs);
-        printf("  pop rax\n");
-        printf("  cmp rax, 0\n");
-        printf("  jne .Ltrue%d\n", seq);
-        printf("  push 0\n");
-        printf("  jmp .Lend%d\n", seq);
-        printf(".Ltrue%d:\n", seq);
-        printf("  push 1\n");
-        printf(".Lend%d:\n", seq);
+        gen(node_at(node->lhs));
+        emit("  pop rax\n");
+        emit("  cmp rax, 0\n");
+        emit_ref("  jne .Ltrue.", funcname, seq);
+        gen(node_at(node->rhs));
+        emit("  pop rax\n");
+        emit("  cmp rax, 0\n");
+        emit_ref("  jne .Ltrue.", funcname, seq);
+        emit("  push 0\n");
+        emit_ref("  jmp .Lend.", funcname, seq);
+        emit_label(".Ltrue.", funcname, seq);
+        emit("  push 1\n");
+        emit_label(".Lend.", funcname, seq);
         return;
     }
     case ND_IF: {
         int seq = labelseq++;
 
         // 条件式を評価しスタックトップに結果を入れる
-        gen(node->cond);
+        gen(node_at(node->cond));
         // 結果を取り出して比較
-        printf("  pop rax\n");
-        printf("  cmp rax, 0\n");
+        emit("  pop rax\n");
+        emit("  cmp rax, 0\n");
 
         if (node->els) {
             // else 節がある場合
             // 偽だったら else 節にジャンプ
-            printf("  je  .Lelse%d\n", seq);
+            emit_ref("  je  .Lelse.", funcname, seq);
             // 真だった場合のコードを生成
-            gen(node->then);
-            printf("  jmp  .Lend%d\n", seq);
-            printf(".Lelse%d:\n", seq);
+            gen(node_at(node->then));
+            emit_ref("  jmp  .Lend.", funcname, seq);
+            emit_label(".Lelse.", funcname, seq);
             // 偽だった場合のコードを生成
-            gen(node->els);
+            gen(node_at(node->els));
         }
         else {
             // else 節がない場合
             // 偽だったら if 文のあとにジャンプ
-            printf("  je  .Lend%d\n", seq);
+            emit_ref("  je  .Lend.", funcname, seq);
             // 真だった場合のコードを生成
-            gen(node->then);
+            gen(node_at(node->then));
         }
 
-        printf(".Lend%d:\n", seq);
+        emit_label(".Lend.", funcname, seq);
 
         return;
     }
@@ -364,16 +375,16 @@ void gen(Node *node) {
         contseq = seq;
 
         // ループで戻って来るときのためのラベルを追加
-        printf(".L.continue.%d:\n", seq);
+        emit_label(".L.continue.", funcname, seq);
         // 条件部を評価
-        gen(node->cond);
-        printf("  pop rax\n");
-        printf("  cmp rax, 0\n");
+        gen(node_at(node->cond));
+        emit("  pop rax\n");
+        emit("  cmp rax, 0\n");
         // 条件を満たしたら末尾にジャンプ
-        printf("  je  .L.break.%d\n", seq);
-        gen(node->then);
-        printf("  jmp .L.continue.%d\n", seq);
-        printf(".L.break.%d:\n", seq);
+        emit_ref("  je  .L.break.", funcname, seq);
+        gen(node_at(node->then));
+        emit_ref("  jmp .L.continue.", funcname, seq);
+        emit_label(".L.break.", funcname, seq);
 
         // ループを抜けるときには、開始時に控えてあった元の brqseq の値に戻す
         // ループがネストしたときの対応のため
@@ -392,31 +403,31 @@ void gen(Node *node) {
 
         if (node->init) {
             // ループに入る前に初期化部を実行
-            gen(node->init);
+            gen(node_at(node->init));
         }
         // while と違い、 begin と continue 用のラベルを分けている
         // for の本体を実行したあとインクリメント部を実行する必要があるため
         // continue はインクリメント部の直前にジャンプする必要がある
-        printf(".Lbegin%d:\n", seq);
+        emit_label(".Lbegin.", funcname, seq);
         if (node->cond) {
             // 条件部を評価しスタックトップにいれる
-            gen(node->cond);
+            gen(node_at(node->cond));
             // スタックトップから値を取り出して比較
-            printf("  pop rax\n");
-            printf("  cmp rax, 0\n");
-            printf("  je  .L.break.%d\n", seq);
+            emit("  pop rax\n");
+            emit("  cmp rax, 0\n");
+            emit_ref("  je  .L.break.", funcname, seq);
         }
         // ループ本体を実行
-        gen(node->then);
+        gen(node_at(node->then));
 
         // continue 文でインクリメント部にジャンプしてこられるようにラベルを出力
-        printf(".L.continue.%d:\n", seq);
+        emit_label(".L.continue.", funcname, seq);
         if (node->inc) {
             // ループ本体が終了したら、インクリメント部を実行
-            gen(node->inc);
+            gen(node_at(node->inc));
         }
-        printf("  jmp  .Lbegin%d\n", seq);
-        printf(".L.break.%d:\n", seq);
+        emit_ref("  jmp  .Lbegin.", funcname, seq);
+        emit_label(".L.break.", funcname, seq);
 
         brkseq = brk;
         contseq = cont;
@@ -426,14 +437,13 @@ void gen(Node *node) {
         int seq = labelseq++;
         int brk = brkseq;
         brkseq = seq;
-        node->case_label = seq;
 
         // switch 文の条件部を評価して rax レジスタに取り出し
-        gen(node->cond);
-        printf("  pop rax\n");
+        gen(node_at(node->cond));
+        emit("  pop rax\n");
 
         // 複数の case 文を順番に変換していく
-        for (Node *n = node->case_next; n; n = n->case_next) {
+        for (Node *n = node_at(node->cases); n; n = node_at(n->case_next)) {
             // あとで case 文をパースするときに使うために Node を更新
             // case ひとつひとつにユニークな数字を割り当て
             n->case_label = labelseq++;
@@ -443,38 +453,38 @@ void gen(Node *node) {
             // 比較してジャンプするコードを出力する
             // val には式や変数ではなく(コンパイル時に確定する)数値が入っているので
             // そのままアセンブラに出力することができる
-            printf("  cmp rax, %ld\n", n->val);
-            printf("  je .L.case.%d\n", n->case_label);
+            emit_num("  cmp rax, ", n->case_val);
+            emit_ref("  je .L.case.", funcname, n->case_label);
         }
 
         if (node->default_case) {
             // default ラベルがあった場合
             int i = labelseq++;
-            node->default_case->case_label = i;
-            node->default_case->case_end_label = seq;
+            node_at(node->default_case)->case_label = i;
+            node_at(node->default_case)->case_end_label = seq;
             // default は条件なしで必ずジャンプする
-            printf("  jmp .L.case.%d\n", i);
+            emit_ref("  jmp .L.case.", funcname, i);
         }
         
         // case 文にマッチせず、かつ default もない場合は switch を抜ける
-        printf("  jmp .L.break.%d\n", seq);
+        emit_ref("  jmp .L.break.", funcname, seq);
 
         // switch 文の中身を出力
-        gen(node->then);
+        gen(node_at(node->then));
 
         // switch を抜ける直前の位置にラベルを出力
-        printf(".L.break.%d:\n", seq);
+        emit_label(".L.break.", funcname, seq);
 
         brkseq = brk;
         return;
     }
     case ND_CASE:
         // まず switch 文の先頭からジャンプに使うラベルを出力
-        printf(".L.case.%d:\n", node->case_label);
-        gen(node->lhs);
+        emit_label(".L.case.", funcname, node->case_label);
+        gen(node_at(node->lhs));
         // case 文の本文を処理し終えたら swtich 文の出口にジャンプ
         // todo: break がなくても脱出してしまう、fall-through できない
-        printf("  jmp .L.break.%d\n", node->case_end_label);
+        emit_ref("  jmp .L.break.", funcname, node->case_end_label);
         return;
     case ND_BLOCK:
     case ND_STMT_EXPR:
@@ -482,7 +492,7 @@ void gen(Node *node) {
         // パースするときに expr_stmt (文) の中身(式)を取り出しているため
         // よってそのままコード生成すれば最終的にスタックトップに最後の式の結果が残る
         // (stmt_expr の場合はスタックトップの値を最後に捨てるようになっている)
-        for (Node *n = node->body; n; n = n->next) {
+        for (Node *n = node_at(node->body); n; n = node_at(n->next)) {
             gen(n);
         }
         return;
@@ -491,22 +501,22 @@ void gen(Node *node) {
         if (brkseq == 0) {
             error_tok(node->tok, "stray break");
         }
-        printf("  jmp .L.break.%d\n", brkseq);
+        emit_ref("  jmp .L.break.", funcname, brkseq);
         return;
     case ND_CONTINUE:
         if (contseq == 0) {
             error_tok(node->tok, "stray continue");
         }
-        printf("  jmp .L.continue.%d\n", contseq);
+        emit_ref("  jmp .L.continue.", funcname, contseq);
         return;
     case ND_GOTO:
         // goto でジャンプできる先は同一関数内に限られるため
         // 生成するラベル名には関数名を prefix として使えば十分
-        printf("  jmp .L.label.%s.%s\n", funcname, node->label_name);
+        emitf("  jmp .L.label.%s.%s\n", funcname, node->label_name);
         return;
     case ND_LABEL:
-        printf(".L.label.%s.%s:\n", funcname, node->label_name);
-        gen(node->lhs);
+        emitf(".L.label.%s.%s:\n", funcname, node->label_name);
+        gen(node_at(node->lhs));
         return;
     case ND_VAR:
     case ND_MEMBER:
@@ -521,30 +531,30 @@ void gen(Node *node) {
         return;
     case ND_ASSIGN:
         // 左辺の変数のアドレスをスタックトップにいれる
-        gen_lval(node->lhs);
+        gen_lval(node_at(node->lhs));
         // 右辺を計算しスタックトップにいれる
-        gen(node->rhs);
+        gen(node_at(node->rhs));
         // スタックに入っている値を、スタックに入っているアドレスに保存
         store(node->ty);
         return;
     case ND_TERNARY: {
         int seq = labelseq++;
-        gen(node->cond);
-        printf("  pop rax\n");
-        printf("  cmp rax, 0\n");
-        printf("  je  .Lelse%d\n", seq);
-        gen(node->then);
-        printf("  jmp .Lend%d\n", seq);
-        printf(".Lelse%d:\n", seq);
-        gen(node->els);
-        printf(".Lend%d:\n", seq);
+        gen(node_at(node->cond));
+        emit("  pop rax\n");
+        emit("  cmp rax, 0\n");
+        emit_ref("  je  .Lelse.", funcname, seq);
+        gen(node_at(node->then));
+        emit_ref("  jmp .Lend.", funcname, seq);
+        emit_label(".Lelse.", funcname, seq);
+        gen(node_at(node->els));
+        emit_label(".Lend.", funcname, seq);
         return;
     }
     case ND_PRE_INC:
         // まずインクリメントの対象となっている式のアドレスを計算してスタックトップに置く
-        gen_lval(node->lhs);
+        gen_lval(node_at(node->lhs));
         // rsp の指す場所にあるデータ(つまり gen_lval で計算した結果)をスタックトップに置く
-        printf("  push [rsp]\n");
+        emit("  push [rsp]\n");
         // この時点でスタックの最上位2つのデータはインクリメントの対象となっている式のアドレス
         // load でスタックトップのアドレスが指す値を取り出し置き換え
         load(node->ty);
@@ -558,16 +568,16 @@ void gen(Node *node) {
         // 式と評価結果としてスタックトップに残っている
         return;
     case ND_PRE_DEC:
-        gen_lval(node->lhs);
-        printf("  push [rsp]\n");
+        gen_lval(node_at(node->lhs));
+        emit("  push [rsp]\n");
         load(node->ty);
         dec(node);
         store(node->ty);
         return;
     case ND_POST_INC:
         // PRE_INC と同様に、スタックの上位2つにインクリメント対象の式のアドレスを準備する
-        gen_lval(node->lhs);
-        printf("  push [rsp]\n");
+        gen_lval(node_at(node->lhs));
+        emit("  push [rsp]\n");
         // load/inc/store で、最上位の値をインクリメントした後の値に変換する
         load(node->ty);
         inc(node);
@@ -579,8 +589,8 @@ void gen(Node *node) {
         // スタックトップはインクリメント前の値に戻っている
         return;
     case ND_POST_DEC:
-        gen_lval(node->lhs);
-        printf("  push [rsp]\n");
+        gen_lval(node_at(node->lhs));
+        emit("  push [rsp]\n");
         load(node->ty);
         dec(node);
         store(node->ty);
@@ -594,15 +604,15 @@ void gen(Node *node) {
     case ND_A_SHR: {
         // x += y は  x = x + y と同じ
         // まず左辺値のアドレスを2つスタックトップに置く
-        gen_lval(node->lhs);
-        printf("  push [rsp]\n");
+        gen_lval(node_at(node->lhs));
+        emit("  push [rsp]\n");
         // スタックトップの値を値で置き換え
-        load(node->lhs->ty);
+        load(node_at(node->lhs)->ty);
         // 加算する値を計算しスタックトップに置く
-        gen(node->rhs);
+        gen(node_at(node->rhs));
         // 式が x += y のとき、この時点でスタックは上から (y の値) (x の値) (x のアドレス)
-        printf("  pop rdi\n");
-        printf("  pop rax\n");
+        emit("  pop rdi\n");
+        emit("  pop rax\n");
         // この時点で rdi と rax に y と x の値がそれぞれ入っている
         // スタックトップには x のアドレスが入っている
 
@@ -611,49 +621,49 @@ void gen(Node *node) {
         case ND_A_ADD:
             if (node->ty->base) {
                 // 配列やポインタ型の場合は変数のサイズをかけた値を足す必要がある
-                printf("  imul rdi, %d\n", size_of(node->ty->base, node->tok));
+                emit_num("  imul rdi, ", size_of(node->ty->base, node->tok));
             }
-            printf("  add rax, rdi\n");
+            emit("  add rax, rdi\n");
             break;
         case ND_A_SUB:
             if (node->ty->base) {
-                printf("  imul rdi, %d\n", size_of(node->ty->base, node->tok));
+                emit_num("  imul rdi, ", size_of(node->ty->base, node->tok));
             }
-            printf("  sub rax, rdi\n");
+            emit("  sub rax, rdi\n");
             break;
         case ND_A_MUL:
-            printf("  imul rax, rdi\n");
+            emit("  imul rax, rdi\n");
             break;
         case ND_A_DIV:
-            printf("  cqo\n");
-            printf("  idiv rdi\n");
+            emit("  cqo\n");
+            emit("  idiv rdi\n");
             break;
         case ND_A_SHL:
-            printf("  mov cl, dil\n");
-            printf("  shl rax, cl\n");
+            emit("  mov cl, dil\n");
+            emit("  shl rax, cl\n");
             break;
         case ND_A_SHR:
-            printf("  mov cl, dil\n");
+            emit("  mov cl, dil\n");
             // 符号付のため SHR ではなく SAR を使う
-            printf("  sar rax, cl\n");
+            emit("  sar rax, cl\n");
             break;
         }
 
         // rax に入った計算結果をスタックトップに置く
-        printf("  push rax\n");
+        emit("  push rax\n");
         // x のアドレスに値を書き戻す
         store(node->ty);
         return;
     }
     case ND_COMMA:
-        gen(node->lhs);
-        gen(node->rhs);
+        gen(node_at(node->lhs));
+        gen(node_at(node->rhs));
         return;
     case ND_ADDR:
-        gen_addr(node->lhs);
+        gen_addr(node_at(node->lhs));
         return;
     case ND_DEREF:
-        gen(node->lhs);
+        gen(node_at(node->lhs));
         if (node->ty->kind != TY_ARRAY) {
             // この node の型が配列型ということなので、deref した結果の型が配列ということ
             // 上記のコードの結果、スタックトップにはアドレスが入っているので、ロード
@@ -665,119 +675,462 @@ void gen(Node *node) {
         return;
     case ND_CAST:
         // 普通に計算するコードを出力したあと truncate する　
-        gen(node->lhs);
+        gen(node_at(node->lhs));
         truncate(node->ty);
         return;
     }
 
     // スタックマシンとして計算する
-    gen(node->lhs);
-    gen(node->rhs);
+    gen(node_at(node->lhs));
+    gen(node_at(node->rhs));
 
-    printf("  pop rdi\n");
-    printf("  pop rax\n");
+    emit("  pop rdi\n");
+    emit("  pop rax\n");
 
     switch (node->kind) {
     case ND_ADD:
         if (node->ty->base) {
             // ポインタ型か配列型の加算の場合の特別処理
             // ポインタへの加算は、ポインタの参照先の型のサイズ分の加算になる
-            printf("  imul rdi, %d\n", size_of(node->ty->base, node->tok));
+            emit_num("  imul rdi, ", size_of(node->ty->base, node->tok));
         }
-        printf("  add rax, rdi\n");
+        emit("  add rax, rdi\n");
         break;
     case ND_SUB:
         if (node->ty->base) {
-            printf("  imul rdi, %d\n", size_of(node->ty->base, node->tok));
+            emit_num("  imul rdi, ", size_of(node->ty->base, node->tok));
         }
-        printf("  sub rax, rdi\n");
+        emit("  sub rax, rdi\n");
         break;
     case ND_MUL:
-        printf("  imul rax, rdi\n");
+        emit("  imul rax, rdi\n");
         break;
     case ND_DIV:
-        printf("  cqo\n");
-        printf("  idiv rdi\n");
+        emit("  cqo\n");
+        emit("  idiv rdi\n");
         break;
     case ND_BITAND:
-        printf("  and rax, rdi\n");
+        emit("  and rax, rdi\n");
         break;
     case ND_BITOR:
-        printf("  or rax, rdi\n");
+        emit("  or rax, rdi\n");
         break;
     case ND_BITXOR:
-        printf("  xor rax, rdi\n");
+        emit("  xor rax, rdi\n");
         break;
     case ND_SHL:
-        printf("  mov cl, dil\n");
-        printf("  shl rax, cl\n");
+        emit("  mov cl, dil\n");
+        emit("  shl rax, cl\n");
         break;
     case ND_SHR:
-        printf("  mov cl, dil\n");
-        printf("  sar rax, cl\n");
+        emit("  mov cl, dil\n");
+        emit("  sar rax, cl\n");
         break;
     case ND_EQ:
-        printf("  cmp rax, rdi\n");
-        printf("  sete al\n");
-        printf("  movzb rax, al\n");
+        emit("  cmp rax, rdi\n");
+        emit("  sete al\n");
+        emit("  movzb rax, al\n");
         break;
     case ND_NE:
-        printf("  cmp rax, rdi\n");
-        printf("  setne al\n");
-        printf("  movzb rax, al\n");
+        emit("  cmp rax, rdi\n");
+        emit("  setne al\n");
+        emit("  movzb rax, al\n");
         break;
     case ND_LT:
-        printf("  cmp rax, rdi\n");
-        printf("  setl al\n");
-        printf("  movzb rax, al\n");
+        emit("  cmp rax, rdi\n");
+        emit("  setl al\n");
+        emit("  movzb rax, al\n");
         break;
     case ND_LE:
-        printf("  cmp rax, rdi\n");
-        printf("  setle al\n");
-        printf("  movzb rax, al\n");
+        emit("  cmp rax, rdi\n");
+        emit("  setle al\n");
+        emit("  movzb rax, al\n");
         break;
     default:
         error("Unknown node: %d\n", node->kind);
         break;
     }
 
-    printf("  push rax\n");
+    emit("  push rax\n");
 }
 
-// データ領域を出力
-void emit_data(Program *prog) {
-    // 0 初期化するのであれば .data ではなく .bss に置くほうがベター
-    // ELF ファイルのサイズが小さくなるため
-    printf(".data\n");
+// 初期値の pos バイト目の値
+static unsigned char init_byte(Initializer *init, int pos) {
+    return pos < init->len ? init->data[pos] : 0;
+}
 
-    for (VarList *vl = prog->globals; vl; vl = vl->next) {
-        Var *var = vl->var;
-        // グローバル変数もアセンブラ上のラベルで表現される
-        // ラベルは単にアドレスのエイリアス
-        printf("%s:\n", var->name);
-
-        if (!var->initializer) {
-            // 初期化子がないグローバル変数はゼロ初期化する
-            // .zero は、指定したバイト数分の領域を 0 初期化して確保する
-            printf("  .zero %d\n", size_of(var->ty, var->tok));
+// 初期値の pos バイト目から sz バイトを、リトルエンディアンの符号なしの値として読む
+static long init_value(Initializer *init, int pos, int sz) {
+    unsigned long val = 0;
+    for (int i = sz - 1; i >= 0; i--) {
+        val = val << 8 | init_byte(init, pos + i);
+    }
+    return val;
+}
+
+// pos バイト目から end の手前までに 0 が何バイト続くか
+static int count_zeros(Initializer *init, int pos, int end) {
+    int i = pos;
+    while (i < end && init_byte(init, i) == 0) {
+        i++;
+    }
+    return i - pos;
+}
+
+// pos バイト目から end の手前までに、.ascii で書いて読みやすい文字が何バイト続くか
+static int count_text(Initializer *init, int pos, int end) {
+    int i = pos;
+    for (; i < end; i++) {
+        unsigned char c = init_byte(init, i);
+        if (!((' ' <= c && c <= '~') || c == '\t' || c == '\n')) {
+            break;
+        }
+    }
+    return i - pos;
+}
+
+// .zero にまとめる 0 の並びの最小の長さ
+#define MIN_ZERO_RUN 8
+
+// 初期値のバイト列の [pos, end) を、続いているものはまとめて出力する
+// 0 の並びは .zero に、文字列らしい並びは .ascii に、それ以外は 8 バイトずつ .quad にする
+// .quad は1行に8個まで並べる
+static void emit_bytes(Initializer *init, int pos, int end) {
+    while (pos < end) {
+        int zeros = count_zeros(init, pos, end);
+        if (zeros >= MIN_ZERO_RUN || (zeros && pos + zeros == end)) {
+            emit_num("  .zero ", zeros);
+            pos += zeros;
             continue;
         }
 
-        // 初期化子がある場合は順番に出力
-        for (Initializer *init = var->initializer; init; init = init->next) {
-            if (init->label) {
-                // 他の変数のポインタの場合は、64ビットデータ(quad)としてラベルをそのまま出力
-                printf("  .quad %s\n", init->label);
-                continue;
+        // 2文字以上続いて 0 で終わるか、8文字以上続く場合は文字列とみなす
+        // 文字は 0 ではないので、すべてバイト列の中にある
+        int text = count_text(init, pos, end);
+        if (text >= 2 && pos + text < end && init_byte(init, pos + text) == 0) {
+            // 終端の 0 は .asciz で出力する
+            emit_string(init->data + pos, text, true);
+            pos += text + 1;
+            continue;
+        }
+        if (text >= 8) {
+            emit_string(init->data + pos, text, false);
+            pos += text;
+            continue;
+        }
+
+        // 長い 0 の並びか範囲の終わりまでを数値として出力する
+        int n = 0;
+        while (pos + n < end && count_zeros(init, pos + n, end) < MIN_ZERO_RUN) {
+            n++;
+        }
+
+        long vals[8];
+        int nvals = 0;
+        for (; n >= 8; n -= 8, pos += 8) {
+            vals[nvals++] = init_value(init, pos, 8);
+            if (nvals == 8) {
+                emit_nums("  .quad ", vals, nvals);
+                nvals = 0;
             }
+        }
+        if (nvals) {
+            emit_nums("  .quad ", vals, nvals);
+        }
+
+        // 8 バイトに満たない残りは、なるべく広いディレクティブで出力する
+        if (n >= 4) {
+            emit_num("  .long ", init_value(init, pos, 4));
+            pos += 4;
+            n -= 4;
+        }
+        if (n >= 2) {
+            emit_num("  .short ", init_value(init, pos, 2));
+            pos += 2;
+            n -= 2;
+        }
+        if (n) {
+            emit_num("  .byte ", init_value(init, pos, 1));
+            pos++;
+        }
+    }
+}
+
+//
+// グローバル変数を書き換えうるかの解析
+// 書き換えられない変数は読み出し専用のセクションに置けるので、関数の中で書き込まれうるか、
+// アドレスが外に出て、どこかで書き込まれうるかを調べる
+// キャッシュから読んだ関数には型がないので、型を使わずに AST の形だけで判断する
+//
 
-            // その他、サイズに応じてデータを出力
-            if (init->sz == 1) {
-                printf("  .byte %ld\n", init->val);
+static void mark_written(Node *node, bool write);
+
+// ポインタの値を計算する式 node について、その指す先を読む(write なら書き込む)場合を調べる
+// 配列の要素へのアクセスは、配列の変数に添字を足したものを参照外しする形になっている
+static void mark_pointee(Node *node, bool write) {
+    if (!node) {
+        return;
+    }
+
+    switch (node->kind) {
+    case ND_VAR:
+        // 配列の要素を読むだけなら配列は書き換えられない
+        // ポインタの変数の場合は、その値を読むだけ
+        // ただし要素が配列や構造体なら、参照外しした値は要素の読み出しではなく行や構造体のアドレスで、
+        // 型がないとどちらか区別できないので、アドレスが外に出るとみなす
+        if (node->var->ty->kind == TY_ARRAY) {
+            TypeKind elem = node->var->ty->base->kind;
+            if (!node->var->is_local && (write || elem == TY_ARRAY || elem == TY_STRUCT)) {
+                node->var->is_written = true;
             }
-            else {
-                printf("  .%dbyte %ld\n", init->sz, init->val);
+            return;
+        }
+        mark_written(node, false);
+        return;
+    case ND_ADD:
+    case ND_SUB:
+        // ポインタと整数のどちらが左右にあるかは型がないとわからないので、両方を調べる
+        // 整数の側にある式は、ここからさらにたどっても普通の値として調べられる
+        mark_pointee(node_at(node->lhs), write);
+        mark_pointee(node_at(node->rhs), write);
+        return;
+    case ND_DEREF:
+        // 多次元配列の内側の参照外しは、配列のアドレスの計算にすぎない
+        // (多次元配列そのものは ND_VAR で書き換えられうるとみなしている)
+        // ポインタの読み出しの場合も、指す先を書き換えるとみなすのは安全側の判断
+    case ND_CAST:
+        mark_pointee(node_at(node->lhs), write);
+        return;
+    default:
+        mark_written(node, false);
+        return;
+    }
+}
+
+// node の中でグローバル変数に書き込みうるものに is_written の印をつける
+// write が true のとき、node は書き込まれる左辺値か、アドレスが外に出る式
+static void mark_written(Node *node, bool write) {
+    if (!node) {
+        return;
+    }
+
+    switch (node->kind) {
+    case ND_VAR:
+        // 配列の値は先頭要素へのポインタなので、値を使うだけでアドレスが外に出る
+        if (!node->var->is_local && (write || node->var->ty->kind == TY_ARRAY)) {
+            node->var->is_written = true;
+        }
+        return;
+    case ND_NUM:
+    case ND_GOTO:
+    case ND_BREAK:
+    case ND_CONTINUE:
+    case ND_NULL:
+    case ND_SIZEOF:
+        // sizeof の中の式は評価されない
+        return;
+    case ND_ASSIGN:
+    case ND_A_ADD:
+    case ND_A_SUB:
+    case ND_A_MUL:
+    case ND_A_DIV:
+    case ND_A_SHL:
+    case ND_A_SHR:
+        mark_written(node_at(node->lhs), true);
+        mark_written(node_at(node->rhs), false);
+        return;
+    case ND_PRE_INC:
+    case ND_PRE_DEC:
+    case ND_POST_INC:
+    case ND_POST_DEC:
+    case ND_ADDR:
+        mark_written(node_at(node->lhs), true);
+        return;
+    case ND_MEMBER:
+        // メンバが配列ならアドレスが外に出るが、型がないとわからないので書き込まれうるとみなす
+        mark_written(node_at(node->lhs), true);
+        return;
+    case ND_DEREF:
+        mark_pointee(node_at(node->lhs), write);
+        return;
+    case ND_CAST:
+        mark_written(node_at(node->lhs), write);
+        return;
+    case ND_COMMA:
+        mark_written(node_at(node->lhs), false);
+        mark_written(node_at(node->rhs), write);
+        return;
+    case ND_IF:
+    case ND_TERNARY:
+        mark_written(node_at(node->cond), false);
+        mark_written(node_at(node->then), write);
+        mark_written(node_at(node->els), write);
+        return;
+    case ND_WHILE:
+    case ND_SWITCH:
+        mark_written(node_at(node->cond), false);
+        mark_written(node_at(node->then), false);
+        return;
+    case ND_FOR:
+        mark_written(node_at(node->init), false);
+        mark_written(node_at(node->cond), false);
+        mark_written(node_at(node->inc), false);
+        mark_written(node_at(node->then), false);
+        return;
+    case ND_BLOCK:
+    case ND_STMT_EXPR:
+        for (Node *n = node_at(node->body); n; n = node_at(n->next)) {
+            mark_written(n, false);
+        }
+        return;
+    case ND_FUNCALL:
+        for (Node *n = node_at(node->args); n; n = node_at(n->next)) {
+            mark_written(n, false);
+        }
+        return;
+    case ND_NOT:
+    case ND_BITNOT:
+    case ND_RETURN:
+    case ND_EXPR_STMT:
+    case ND_LABEL:
+    case ND_CASE:
+        mark_written(node_at(node->lhs), false);
+        return;
+    default:
+        // 二項演算子
+        mark_written(node_at(node->lhs), false);
+        mark_written(node_at(node->rhs), false);
+        return;
+    }
+}
+
+// すべての関数の本体と、グローバル変数の初期値のアドレスを調べる
+static void mark_written_globals(Program *prog) {
+    for (Function *fn = prog->fns; fn; fn = fn->next) {
+        node_base = fn->nodes;
+        for (Node *node = node_at(fn->node); node; node = node_at(node->next)) {
+            mark_written(node, false);
+        }
+    }
+
+    for (VarList *vl = prog->globals; vl; vl = vl->next) {
+        if (vl->var->initializer) {
+            for (Reloc *rel = vl->var->initializer->rels; rel; rel = rel->next) {
+                rel->var->is_written = true;
+            }
+        }
+    }
+}
+
+//
+// データ領域の出力
+//
+
+// グローバル変数を置くセクション
+typedef enum {
+    SEC_DATA,       // 書き換えられうる変数
+    SEC_RELRO,      // 書き換えられないが、ほかの変数のアドレスを含む変数
+    SEC_RODATA,     // 書き換えられない変数
+    SEC_STRING,     // 文字列リテラル、同じ文字列はリンカがまとめる
+    SEC_BSS,        // 0 で初期化される変数
+    SEC_NUM,
+} Section;
+
+static char *section_names[] = {
+    [SEC_DATA] = ".data\n",
+    // 実行時に再配置されうるので、再配置のあとで読み出し専用になるセクションに置く
+    [SEC_RELRO] = ".section .data.rel.ro,\"aw\"\n",
+    [SEC_RODATA] = ".section .rodata\n",
+    // 要素の大きさが 1 の NUL 終端の文字列を並べたセクション
+    [SEC_STRING] = ".section .rodata.str1.1,\"aMS\",@progbits,1\n",
+    [SEC_BSS] = ".bss\n",
+};
+
+static bool is_zero(Initializer *init) {
+    if (init->rels) {
+        return false;
+    }
+    for (int i = 0; i < init->len; i++) {
+        if (init->data[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static Section section_of(Var *var) {
+    Initializer *init = var->initializer;
+    if (var->is_literal) {
+        // 文字列リテラルは書き換えられない
+        // 途中に NUL 文字を含むものは、リンカが文字列の区切りを誤るのでまとめられない
+        if (init->len == init->size - 1 && !memchr(init->data, 0, init->len)) {
+            return SEC_STRING;
+        }
+        return SEC_RODATA;
+    }
+    if (!init || is_zero(init)) {
+        // ファイルには大きさだけを記録し、実行時に 0 で埋めた領域を用意する
+        return SEC_BSS;
+    }
+    if (!var->is_written) {
+        return init->rels ? SEC_RELRO : SEC_RODATA;
+    }
+    return SEC_DATA;
+}
+
+static void emit_var(Var *var, Section sec) {
+    // 文字列リテラルのラベルはシンボルテーブルに入らないので、型と大きさはつけない
+    if (!var->is_literal) {
+        emitf("  .type %s, @object\n", var->name);
+        emitf("  .size %s, %d\n", var->name, size_of(var->ty, var->tok));
+    }
+    if (var->ty->align > 1) {
+        emit_num("  .align ", var->ty->align);
+    }
+    // グローバル変数もアセンブラ上のラベルで表現される
+    // ラベルは単にアドレスのエイリアス
+    emitf("%s:\n", var->name);
+
+    Initializer *init = var->initializer;
+    if (sec == SEC_STRING) {
+        // 文字列リテラルは1つの文字列として出力する
+        emit_string(init->data, init->len, true);
+        return;
+    }
+    if (sec == SEC_BSS) {
+        // 初期化子がないグローバル変数はゼロ初期化する
+        // .zero は、指定したバイト数分の領域を 0 初期化して確保する
+        emit_num("  .zero ", size_of(var->ty, var->tok));
+        return;
+    }
+
+    // 初期値がある場合は、リロケーションの間のバイト列をまとめて出力
+    int pos = 0;
+    for (Reloc *rel = init->rels; rel; rel = rel->next) {
+        emit_bytes(init, pos, rel->offset);
+        // 他の変数のポインタの場合は、64ビットデータ(quad)としてラベルをそのまま出力
+        emit_sym("  .quad ", rel->var->name);
+        pos = rel->offset + 8;
+    }
+    emit_bytes(init, pos, init->size);
+}
+
+// データ領域を出力
+// 変数はセクションごとにまとめて出力する
+void emit_data(Program *prog) {
+    mark_written_globals(prog);
+
+    for (Section sec = 0; sec < SEC_NUM; sec++) {
+        bool first = true;
+        for (VarList *vl = prog->globals; vl; vl = vl->next) {
+            if (section_of(vl->var) != sec) {
+                continue;
+            }
+            if (first) {
+                emit(section_names[sec]);
+                first = false;
             }
+            emit_var(vl->var, sec);
         }
     }
 }
@@ -786,60 +1139,187 @@ void emit_data(Program *prog) {
 void load_arg(Var *var, int idx) {
     int sz = size_of(var->ty, var->tok);
     if (sz == 1) {
-        printf("  mov [rbp-%d], %s\n", var->offset, argreg1[idx]);
+        emitf("  mov [rbp-%d], %s\n", var->offset, argreg1[idx]);
     }
     else if (sz == 2) {
-        printf("  mov [rbp-%d], %s\n", var->offset, argreg2[idx]);
+        emitf("  mov [rbp-%d], %s\n", var->offset, argreg2[idx]);
     }
     else if (sz == 4) {
-        printf("  mov [rbp-%d], %s\n", var->offset, argreg4[idx]);
+        emitf("  mov [rbp-%d], %s\n", var->offset, argreg4[idx]);
     }
     else {
         assert(sz == 8);
-        printf("  mov [rbp-%d], %s\n", var->offset, argreg8[idx]);
+        emitf("  mov [rbp-%d], %s\n", var->offset, argreg8[idx]);
+    }
+}
+
+// 関数1つ分のコードを出力
+void emit_function(Function *fn) {
+    emit_sym(".globl ", fn->name);
+    emitf("%s:\n", fn->name);
+    funcname = fn->name;
+    labelseq = 1;
+    brkseq = 0;
+    contseq = 0;
+
+    // プロローグ
+    emit("# prologue\n");
+    emit("  push rbp\n");
+    emit("  mov rbp, rsp\n");
+    emit_num("  sub rsp, ", fn->stack_size);
+
+    // レジスタに置かれた引数をスタックに書き込む
+    int i = 0;
+    for (VarList *vl = fn->params;vl; vl = vl->next) {
+        load_arg(vl->var, i++);
+    }
+
+    emit("# program body\n");
+    // AST を読み取りコードを生成する
+    // ノードは関数ごとの領域にあるので、この関数の領域からたどる
+    node_base = fn->nodes;
+    for (Node *node = node_at(fn->node); node; node = node_at(node->next)) {
+        gen(node);
+    }
+
+    // エピローグ
+    emit("# epilogue\n");
+    emitf(".Lreturn.%s:\n", funcname);
+    // スタックを戻す
+    emit("  mov rsp, rbp\n");
+    emit("  pop rbp\n");
+    // 最後の式の評価結果が rax に残っているのでそのまま ret すればいい
+    emit("  ret\n");
+}
+
+// ワーカーが分担して処理する関数の一覧
+typedef struct {
+    char *filename;     // エラーメッセージ用
+    Function **fns;
+    OutBuf **bufs;      // 関数ごとの出力
+    int nfns;
+    atomic_int next;    // 次に処理する関数の番号
+    _Atomic(char *) error;  // 最初に起きたエラーのメッセージ
+} CodegenJob;
+
+// まだ誰も手をつけていない関数を1つずつ取り出し、専用のバッファにコードを生成する
+static void codegen_loop(void *arg) {
+    CodegenJob *job = arg;
+
+    // ほかのワーカーがエラーを見つけたら、残りの関数は生成しない
+    while (!atomic_load(&job->error)) {
+        int i = atomic_fetch_add(&job->next, 1);
+        if (i >= job->nfns) {
+            break;
+        }
+        Function *fn = job->fns[i];
+        job->bufs[i] = new_outbuf();
+        emit_to(job->bufs[i]);
+        if (fn->cached) {
+            emit_raw(fn->cached, fn->cached_len, fn->cached_insns);
+        }
+        else {
+            emit_function(fn);
+        }
     }
 }
 
+static void *codegen_worker(void *arg) {
+    CodegenJob *job = arg;
+    OutBuf *prev = emit_to(NULL);
+    // コンパイル中の状態はスレッドごとにあるので、エラーメッセージに使うファイル名を引き継ぐ
+    filename = job->filename;
+
+    // ワーカーのスレッドからは呼び出し元に戻れないので、エラーはここで受け取る
+    // 最初のエラーだけを残し、コード生成を始めたスレッドで報告しなおす
+    char *msg = catch_error(codegen_loop, job);
+    char *expected = NULL;
+    if (msg && !atomic_compare_exchange_strong(&job->error, &expected, msg)) {
+        free(msg);
+    }
+
+    emit_to(prev);
+    return NULL;
+}
+
 // テキスト領域を出力
+// 関数ごとのコード生成は互いに独立しているので、複数のスレッドで分担する
+// 結果は元の順番どおりにつなげるので、出力はスレッドの数によらず同じになる
 void emit_text(Program *prog) {
-    printf(".text\n");
+    emit(".text\n");
+
+    int nfns = 0;
+    for (Function *fn = prog->fns; fn; fn = fn->next) {
+        nfns++;
+    }
+
+    CodegenJob job = {};
+    job.fns = malloc(sizeof(Function *) * nfns);
+    job.bufs = calloc(nfns, sizeof(OutBuf *));
+    job.filename = filename;
+    job.nfns = nfns;
+    atomic_init(&job.next, 0);
+    atomic_init(&job.error, NULL);
 
+    int i = 0;
     for (Function *fn = prog->fns; fn; fn = fn->next) {
-        printf(".globl %s\n", fn->name);
-        printf("%s:\n", fn->name);
-        funcname = fn->name;
+        job.fns[i++] = fn;
+    }
 
-        // プロローグ
-        printf("# prologue\n");
-        printf("  push rbp\n");
-        printf("  mov rbp, rsp\n");
-        printf("  sub rsp, %d\n", fn->stack_size);
+    int nthreads = codegen_threads;
+    if (nthreads <= 0) {
+        nthreads = get_nprocs();
+    }
+    if (nthreads > nfns) {
+        nthreads = nfns;
+    }
 
-        // レジスタに置かれた引数をスタックに書き込む
-        int i = 0;
-        for (VarList *vl = fn->params;vl; vl = vl->next) {
-            load_arg(vl->var, i++);
+    // 呼び出し元のスレッドも1つのワーカーとして働く
+    // スレッドを作れなかった場合は、作れた分だけで続ける
+    // ここで error すると、動き始めたワーカーがこの関数のスタックにある job を指したまま残る
+    pthread_t *threads = malloc(sizeof(pthread_t) * nthreads);
+    for (int i = 1; i < nthreads; i++) {
+        if (pthread_create(&threads[i], NULL, codegen_worker, &job)) {
+            nthreads = i;
+            break;
         }
+    }
+    codegen_worker(&job);
+    for (int i = 1; i < nthreads; i++) {
+        pthread_join(threads[i], NULL);
+    }
 
-        printf("# program body\n");
-        // AST を読み取りコードを生成する
-        for (Node *node = fn->node; node; node = node->next) {
-            gen(node);
+    char *msg = atomic_load(&job.error);
+    for (int i = 0; i < nfns; i++) {
+        if (msg) {
+            // エラーがあった場合、生成したコードは捨てる
+            if (job.bufs[i]) {
+                free_outbuf(job.bufs[i]);
+            }
+            continue;
+        }
+        // 新しく生成した関数のコードはキャッシュに保存しておく
+        Function *fn = job.fns[i];
+        if (cache_dir && !fn->cached) {
+            size_t len;
+            long insns;
+            char *code = outbuf_data(job.bufs[i], &len, &insns);
+            cache_store(fn, code, len, insns);
         }
+        emit_append(job.bufs[i]);
+    }
+
+    free(threads);
+    free(job.fns);
+    free(job.bufs);
 
-        // エピローグ
-        printf("# epilogue\n");
-        printf(".Lreturn.%s:\n", funcname);
-        // スタックを戻す
-        printf("  mov rsp, rbp\n");
-        printf("  pop rbp\n");
-        // 最後の式の評価結果が rax に残っているのでそのまま ret すればいい
-        printf("  ret\n");
+    if (msg) {
+        raise_error(msg);
     }
 }
 
 void codegen(Program *prog) {
-    printf(".intel_syntax noprefix\n");
+    emit(".intel_syntax noprefix\n");
     emit_data(prog);
     emit_text(prog);
 }
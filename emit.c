@@ -0,0 +1,339 @@
+#include <stdarg.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "9cc.h"
+
+// 出力バッファの初期サイズ
+#define OUTBUF_INIT (1 << 20)
+
+// 出力先はファイルごとに違うので、コンパイルしているスレッドごとに持つ
+
+// 出力先のファイル名(NULL なら標準出力)
+static _Thread_local char *out_path;
+static _Thread_local int out_fd = -1;
+
+// アセンブリではなく、アセンブルしたオブジェクトファイルを出力する
+static _Thread_local bool out_object;
+
+// out_fd がこの値のときはメモリに出力する
+#define MEMORY_OUTPUT -2
+
+// 生成したアセンブリをためておくバッファ
+// printf を命令ごとに呼ぶと stdio のロックと書式の解釈が重いので、
+// 自前のバッファに書き込み、flush のときに write でまとめて出力する
+struct OutBuf {
+    char *data;
+    size_t len;
+    size_t cap;
+    long insns;     // 書き込んだ命令の数
+};
+
+// 出力先に書き出すバッファ
+static _Thread_local OutBuf out;
+
+// emit などが書き込むバッファ、NULL なら out に書き込む
+// 関数ごとのコード生成はスレッドごとに別のバッファに書き込む
+static _Thread_local OutBuf *cur;
+
+// 出力先を設定する
+// ファイルは最初に flush するときに開くので、コンパイルエラーで終わったときは作られない
+// object なら、出力したアセンブリを emit_close でアセンブルし、ELF のオブジェクトファイルとして書き出す
+void emit_open(char *path, bool object) {
+    out_path = path;
+    out_object = object;
+    out_fd = -1;
+    out.len = 0;
+    out.insns = 0;
+    cur = NULL;
+}
+
+// このスレッドの出力先のバッファを解放する
+void emit_release() {
+    free(out.data);
+    out = (OutBuf){};
+    cur = NULL;
+}
+
+// 出力先とは別のバッファを作る
+// 書き込んだ内容は emit_append で出力先のバッファに移す
+OutBuf *new_outbuf() {
+    // 関数1つ分のコードは小さいので、出力先のバッファより小さく始める
+    OutBuf *buf = calloc(1, sizeof(OutBuf));
+    buf->cap = 4096;
+    buf->data = malloc(buf->cap);
+    return buf;
+}
+
+// このスレッドの emit の書き込み先を buf に切り替え、元の書き込み先を返す
+// buf が NULL なら出力先のバッファに戻す
+// 他のスレッドの出力先のバッファには書き込めない
+OutBuf *emit_to(OutBuf *buf) {
+    OutBuf *prev = cur;
+    cur = buf;
+    return prev;
+}
+
+// バッファに少なくとも n バイトの空きを作り、書き込み位置を返す
+static char *reserve(size_t n) {
+    OutBuf *b = cur ? cur : &out;
+    if (b->len + n > b->cap) {
+        size_t cap = b->cap ? b->cap : OUTBUF_INIT;
+        while (b->len + n > cap) {
+            cap *= 2;
+        }
+        b->data = realloc(b->data, cap);
+        if (!b->data) {
+            error("out of memory");
+        }
+        b->cap = cap;
+    }
+    return b->data + b->len;
+}
+
+static void put(char *s, size_t len) {
+    memcpy(reserve(len), s, len);
+    (cur ? cur : &out)->len += len;
+}
+
+// 命令の行であれば数える
+// 命令はインデントされていて、"." で始まるディレクティブではない
+static void count_insn(char *s) {
+    if (s[0] == ' ' && s[1] == ' ' && s[2] != '.') {
+        (cur ? cur : &out)->insns++;
+    }
+}
+
+// 10進数に変換して書き込む
+static void put_num(long val) {
+    char tmp[24];
+    char *p = tmp + sizeof(tmp);
+    // LONG_MIN でも溢れないよう符号なしで計算する
+    unsigned long u = val < 0 ? -(unsigned long)val : val;
+
+    do {
+        *--p = '0' + u % 10;
+        u /= 10;
+    } while (u);
+    if (val < 0) {
+        *--p = '-';
+    }
+    put(p, tmp + sizeof(tmp) - p);
+}
+
+// 文字列をそのまま出力する
+void emit(char *s) {
+    count_insn(s);
+    put(s, strlen(s));
+}
+
+// printf と同じ書式で出力する
+// 決まった形の命令には、書式を解釈しない以下の専用の関数を使う
+void emitf(char *fmt, ...) {
+    count_insn(fmt);
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(reserve(256), 256, fmt, ap);
+    va_end(ap);
+
+    // 書式の変換に失敗したときに、負の値を書き込んだ長さとして足さない
+    if (n < 0) {
+        error("emitf: invalid format: %s", fmt);
+    }
+    if (n >= 256) {
+        // バッファに収まらなかった場合は、必要なサイズを確保して書き直す
+        va_start(ap, fmt);
+        vsnprintf(reserve(n + 1), n + 1, fmt, ap);
+        va_end(ap);
+    }
+    (cur ? cur : &out)->len += n;
+}
+
+// "<s><val>\n" を出力する
+// e.g., emit_num("  add rax, ", 8) => "  add rax, 8\n"
+void emit_num(char *s, long val) {
+    count_insn(s);
+    put(s, strlen(s));
+    put_num(val);
+    put("\n", 1);
+}
+
+// "<s><sym>\n" を出力する
+// e.g., emit_sym("  call ", "foo") => "  call foo\n"
+void emit_sym(char *s, char *sym) {
+    count_insn(s);
+    put(s, strlen(s));
+    put(sym, strlen(sym));
+    put("\n", 1);
+}
+
+// 関数内で連番をふったラベルへの参照 "<s><fn>.<seq>\n" を出力する
+// e.g., emit_ref("  jmp .Lend.", "main", 3) => "  jmp .Lend.main.3\n"
+void emit_ref(char *s, char *fn, int seq) {
+    count_insn(s);
+    put(s, strlen(s));
+    put(fn, strlen(fn));
+    put(".", 1);
+    put_num(seq);
+    put("\n", 1);
+}
+
+// 関数内で連番をふったラベル "<s><fn>.<seq>:\n" を出力する
+// e.g., emit_label(".Lend.", "main", 3) => ".Lend.main.3:\n"
+void emit_label(char *s, char *fn, int seq) {
+    put(s, strlen(s));
+    put(fn, strlen(fn));
+    put(".", 1);
+    put_num(seq);
+    put(":\n", 2);
+}
+
+// 別に生成しておいた命令 insns 個分のコードをそのまま出力する
+void emit_raw(char *s, size_t len, long insns) {
+    put(s, len);
+    (cur ? cur : &out)->insns += insns;
+}
+
+// buf に書き込んだ内容と命令の数を返す
+char *outbuf_data(OutBuf *buf, size_t *len, long *insns) {
+    *len = buf->len;
+    *insns = buf->insns;
+    return buf->data;
+}
+
+// len バイトのデータ p を "  .ascii \"...\"\n" として出力する
+// asciz なら "  .asciz \"...\"\n" として、後ろに NUL 文字を1つ加える
+// 表示できる文字はそのまま書き、それ以外は8進数のエスケープにする
+// 8進数のエスケープは後ろに数字が続いても区切れるよう、常に3桁で書く
+void emit_string(char *p, int len, bool asciz) {
+    put(asciz ? "  .asciz \"" : "  .ascii \"", 10);
+    int start = 0;
+    for (int i = 0; i < len; i++) {
+        unsigned char c = p[i];
+        if (' ' <= c && c <= '~' && c != '"' && c != '\\') {
+            continue;
+        }
+        // ここまでのエスケープの要らない部分をまとめて書き込む
+        put(p + start, i - start);
+        char esc[4] = {'\\', '0' + (c >> 6), '0' + ((c >> 3) & 7), '0' + (c & 7)};
+        put(esc, 4);
+        start = i + 1;
+    }
+    put(p + start, len - start);
+    put("\"\n", 2);
+}
+
+// n 個の値をカンマで区切って "<s><vals[0]>, <vals[1]>, ...\n" として出力する
+// e.g., emit_nums("  .quad ", vals, 2) => "  .quad 1, 2\n"
+void emit_nums(char *s, long *vals, int n) {
+    put(s, strlen(s));
+    for (int i = 0; i < n; i++) {
+        if (i) {
+            put(", ", 2);
+        }
+        put_num(vals[i]);
+    }
+    put("\n", 1);
+}
+
+void free_outbuf(OutBuf *buf) {
+    free(buf->data);
+    free(buf);
+}
+
+// buf の内容をこのスレッドの書き込み先に追加し、buf を解放する
+void emit_append(OutBuf *buf) {
+    if (buf->len) {
+        put(buf->data, buf->len);
+    }
+    (cur ? cur : &out)->insns += buf->insns;
+    free_outbuf(buf);
+}
+
+// 出力先をメモリにする
+// 出力したアセンブリは emit_close_mem で受け取る
+void emit_open_mem() {
+    emit_open(NULL, false);
+    out_fd = MEMORY_OUTPUT;
+}
+
+// メモリに出力したアセンブリを NUL 終端して返す
+// 返したバッファは呼び出し側が free する
+char *emit_close_mem(size_t *len) {
+    assert(out_fd == MEMORY_OUTPUT);
+    put("", 1);
+    char *data = out.data;
+    if (len) {
+        *len = out.len - 1;
+    }
+
+    out.data = NULL;
+    out.len = 0;
+    out.cap = 0;
+    out_fd = -1;
+    return data;
+}
+
+// バッファの中身を出力先に書き出して空にする
+void emit_flush() {
+    if (out_fd == MEMORY_OUTPUT) {
+        return;
+    }
+    if (out_fd < 0) {
+        if (out_path && strcmp(out_path, "-")) {
+            out_fd = open(out_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            if (out_fd < 0) {
+                error("cannot open %s: %s", out_path, strerror(errno));
+            }
+        }
+        else {
+            out_fd = STDOUT_FILENO;
+        }
+    }
+
+    char *p = out.data;
+    size_t len = out.len;
+    while (len > 0) {
+        ssize_t n = write(out_fd, p, len);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            error("write failed: %s", strerror(errno));
+        }
+        p += n;
+        len -= n;
+    }
+    out.len = 0;
+}
+
+// 出力先に書き込んだ命令の数を返す
+long emit_insn_count() {
+    return out.insns;
+}
+
+// バッファのアセンブリをアセンブルし、オブジェクトファイルの中身に置き換える
+static void assemble_output() {
+    double start = now();
+    // アセンブラは数を読むときに行末を越えて読むことがあるので、NUL 終端しておく
+    *reserve(1) = '\0';
+    size_t len;
+    char *obj = assemble(out.data, out.len, &len);
+    free(out.data);
+    out.data = obj;
+    out.len = len;
+    out.cap = len;
+    stats.phase_time[PHASE_ASSEMBLE] = now() - start;
+}
+
+// 書き出しを終えて出力先を閉じる
+void emit_close() {
+    if (out_object) {
+        assemble_output();
+    }
+    emit_flush();
+    if (out_fd != STDOUT_FILENO && close(out_fd) < 0) {
+        error("cannot close %s: %s", out_path, strerror(errno));
+    }
+    out_fd = -1;
+}
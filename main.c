@@ -1,24 +1,40 @@
 #include <stdarg.h>
 #include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/sysinfo.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <time.h>
 #include "9cc.h"
 
-#ifdef DEBUG
-#include "utility.h"
-#endif
+// ファイルディスクリプタから最後まで読み込む
+// 標準入力やパイプはサイズがわからないので、バッファを広げながら読む
+// len には末尾の改行を含み、NUL を含まない長さが入る
+char *read_stream(int fd, char *path, size_t *len) {
+    size_t cap = 64 * 1024;
+    size_t size = 0;
+    char *buf = malloc(cap);
 
-char *read_file(char *path) {
-    FILE *fp = fopen(path, "r");
-    if (!fp) {
-        error("cannot open %s: %s", path, strerror(errno));
-    }
-
-    int filemax = 10 * 1024 * 1024;
-    char *buf = malloc(filemax);
-    // 確保した領域を全部使って読む
-    int size = fread(buf, 1, filemax - 2, fp);
-    if (!feof(fp)) {
-        // 読みきれなかったらエラー
-        error("%s: file too large");
+    for (;;) {
+        // 末尾に改行と NUL を置けるよう、常に2バイト以上の空きを残しておく
+        if (cap - size < 2 + 4096) {
+            cap *= 2;
+            buf = realloc(buf, cap);
+        }
+        ssize_t n = read(fd, buf + size, cap - size - 2);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            error("%s: read error: %s", path, strerror(errno));
+        }
+        if (n == 0) {
+            break;
+        }
+        size += n;
     }
 
     // ソースファイルの末尾は改行文字で終わることを強制する
@@ -26,98 +42,333 @@ char *read_file(char *path) {
         buf[size++] = '\n';
     }
     buf[size] = '\0';
+    *len = size;
     return buf;
 }
 
-// エラーメッセージを出力して終了する
-// foo.c:10: x = y + 1:
-//               ^ <error message here>
-void verror_at(char *loc, char *fmt, va_list ap) {
-    char *line = loc;
-    // loc から1文字ずつ戻りながら改行直後の位置を探す
-    while (user_input < line && line[-1] != '\n') {
-        line--;
+// ソースファイルを読み込む
+// 通常のファイルはコピーせずに mmap し、トークンは mmap した領域を直接指す
+// path が "-" の場合は標準入力から読む
+// len にはソースの長さ(末尾の改行を含む)が、mapped には mmap した領域の長さが入る
+// malloc したバッファを返した場合、mapped は 0
+// ソースが NUL 文字を含むこともあるので、長さは strlen ではなく len を使う
+char *read_file(char *path, size_t *len, size_t *mapped) {
+    *mapped = 0;
+    if (!strcmp(path, "-")) {
+        return read_stream(STDIN_FILENO, "<stdin>", len);
     }
 
-    // loc から1文字ずつ進めながら行末の位置を探す
-    char *end = loc;
-    while (*end != '\n') {
-        end++;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        error("cannot open %s: %s", path, strerror(errno));
     }
 
-    // 先頭から改行文字を数え、loc の行番号を求める
-    int line_num = 1;
-    for (char *p = user_input; p < line; p++) {
-        if (*p == '\n') {
-            line_num++;
-        }
+    struct stat st;
+    if (fstat(fd, &st) < 0) {
+        error("cannot stat %s: %s", path, strerror(errno));
+    }
+    if (!S_ISREG(st.st_mode)) {
+        char *buf = read_stream(fd, path, len);
+        close(fd);
+        return buf;
     }
 
-    // ファイル名、行数、行の内容を表示
-    int indent = fprintf(stderr, "%s:%d: ", filename, line_num);
-    // コードはヌル終端になっていないので1行で強制的に切る必要がある
-    // "." と "s" を組み合わせると、指定した文字数で切り捨てることができる
-    fprintf(stderr, "%.*s\n", (int)(end - line), line);
+    // 末尾に改行と NUL を置けるよう、ファイルより2バイト以上大きい無名領域を予約し、
+    // その先頭にファイルを重ねてマップする
+    // ファイルの最後のページのファイル末尾以降と、後ろの無名ページはゼロで埋められているので
+    // NUL 終端はすでにできている
+    size_t size = st.st_size;
+    size_t page = sysconf(_SC_PAGESIZE);
+    size_t map_len = (size + 2 + page - 1) / page * page;
 
-    // エラーメッセージを表示
-    int pos = loc - line + indent;
-    fprintf(stderr, "%*s", pos, "");
-    fprintf(stderr, "^ ");
-    vfprintf(stderr, fmt, ap);
-    fprintf(stderr, "\n");
-    exit(1);
+    char *buf = mmap(NULL, map_len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (buf == MAP_FAILED) {
+        error("%s: mmap failed: %s", path, strerror(errno));
+    }
+    if (size > 0 &&
+        mmap(buf, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED) {
+        error("%s: mmap failed: %s", path, strerror(errno));
+    }
+    close(fd);
+    *mapped = map_len;
+
+    // ソースファイルの末尾は改行文字で終わることを強制する
+    // MAP_PRIVATE なので、書き込んでもファイルは変更されず、そのページだけが複製される
+    if (size == 0 || buf[size - 1] != '\n') {
+        buf[size++] = '\n';
+    }
+    *len = size;
+    return buf;
 }
 
-// エラー箇所を報告する
-void error_at(char *loc, char *fmt, ...) {
-    va_list ap;
-    va_start(ap, fmt);
-    verror_at(loc, fmt, ap);
+// コンパイルを任せるサーバのソケット、NULL なら自分でコンパイルする
+static char *server_path;
+
+// -c が指定されたら、アセンブリではなく ELF のオブジェクトファイルを出力する
+static bool object_output;
+
+// コンパイルの統計を出力する形式
+typedef enum {
+    REPORT_NONE,
+    REPORT_TEXT,    // --time-report
+    REPORT_JSON,    // --stats=json
+} ReportKind;
+
+// 1つのソースファイルをコンパイルし、アセンブリかオブジェクトファイルを output に出力する
+// output が NULL なら標準出力に出力する
+// コンパイル中の状態はスレッドごとにあるので、別のスレッドで別のファイルを同時にコンパイルできる
+void compile_file(char *path, char *output, bool arena_stats, ReportKind report) {
+    // トークナイズし、パースして AST を作る
+    // エラーが起きたら、その場でメッセージを表示して終了する
+    filename = path;
+    size_t len;
+    size_t mapped;
+    user_input = read_file(path, &len, &mapped);
+
+    // サーバが動いていればコンパイルを任せ、つながらなければ自分でコンパイルする
+    // 要求で送れるのはファイル名とスレッド数とソースだけなので、統計の出力を指定されたときは、
+    // その結果を得られるよう自分でコンパイルする
+    // キャッシュのディレクトリも送れず、サーバは自分の設定でコンパイルするので、
+    // 指定されたディレクトリを使うよう、そのときも自分でコンパイルする
+    bool use_server = server_path && report == REPORT_NONE && !arena_stats && !cache_dir;
+    if (!use_server || !run_client(server_path, path, user_input, len, output, object_output)) {
+        emit_open(output, object_output);
+        compile();
+        emit_close();
+
+        if (report == REPORT_TEXT) {
+            flockfile(stderr);
+            print_time_report(stderr, path);
+            funlockfile(stderr);
+        }
+        else if (report == REPORT_JSON) {
+            flockfile(stderr);
+            print_stats_json(stderr, path);
+            funlockfile(stderr);
+        }
+    }
+
+    if (arena_stats) {
+        flockfile(stderr);
+        fprintf(stderr, "%s:\n", path);
+        arena_report(stderr);
+        funlockfile(stderr);
+    }
+
+    // 次のファイルのために、このファイルのために確保したものを解放する
+    arena_reset_all();
+    if (mapped) {
+        munmap(user_input, mapped);
+    }
+    else {
+        free(user_input);
+    }
+    user_input = NULL;
+    filename = NULL;
 }
 
-void error_tok(Token *tok, char *fmt, ...) {
-    va_list ap;
-    va_start(ap, fmt);
-    if (tok) {
-        verror_at(tok->str, fmt, ap);
+// 入力ファイル名から出力ファイル名を作る
+// cc -S や cc -c と同じく、ディレクトリを除いた名前の拡張子を ext に変えて今のディレクトリに置く
+char *output_name(char *path, char *ext) {
+    char *base = strrchr(path, '/');
+    base = base ? base + 1 : path;
+
+    int len = strlen(base);
+    if (len > 2 && !strcmp(base + len - 2, ".c")) {
+        len -= 2;
     }
 
-    vfprintf(stderr, fmt, ap);
-    fprintf(stderr, "\n");
-    exit(1);
+    char *buf = malloc(len + strlen(ext) + 1);
+    sprintf(buf, "%.*s%s", len, base, ext);
+    return buf;
+}
+
+// 複数のファイルのコンパイルをワーカーで分担する
+typedef struct {
+    char **inputs;
+    char **outputs;
+    double *elapsed;    // ファイルごとのコンパイル時間
+    int ninputs;
+    bool arena_stats;
+    ReportKind report;
+    int codegen_threads;
+    atomic_int next;    // 次にコンパイルするファイルの番号
+} CompileJob;
+
+static void *compile_worker(void *arg) {
+    CompileJob *job = arg;
+    codegen_threads = job->codegen_threads;
+    stats.enabled = job->report != REPORT_NONE;
+    for (;;) {
+        int i = atomic_fetch_add(&job->next, 1);
+        if (i >= job->ninputs) {
+            return NULL;
+        }
+        double start = now();
+        compile_file(job->inputs[i], job->outputs[i], job->arena_stats, job->report);
+        job->elapsed[i] = now() - start;
+    }
 }
 
 int main(int argc, char **argv) {
-    if (argc != 2) {
-        error("Wrong number of arguments\n");
+    bool arena_stats = false;
+    char *output = NULL;
+    int njobs = 0;
+    char *server = NULL;
+    ReportKind report = REPORT_NONE;
+    char **inputs = calloc(argc, sizeof(char *));
+    int ninputs = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--arena-report")) {
+            // コンパイル終了時に領域ごとのメモリ使用量を出力する
+            arena_stats = true;
+            continue;
+        }
+        if (!strcmp(argv[i], "--time-report")) {
+            // フェーズごとの時間と各種のカウンタを表にして出力する
+            report = REPORT_TEXT;
+            continue;
+        }
+        if (!strcmp(argv[i], "--stats=json")) {
+            // --time-report と同じ内容を、ファイルごとに1行の JSON で出力する
+            report = REPORT_JSON;
+            continue;
+        }
+        if (!strcmp(argv[i], "--threads")) {
+            // 関数ごとのコード生成に使うスレッドの数
+            if (++i == argc) {
+                error("--threads: missing number");
+            }
+            codegen_threads = atoi(argv[i]);
+            continue;
+        }
+        if (!strcmp(argv[i], "-j")) {
+            // 同時にコンパイルするファイルの数、指定がなければ CPU の数
+            if (++i == argc) {
+                error("-j: missing number");
+            }
+            njobs = atoi(argv[i]);
+            continue;
+        }
+        if (!strcmp(argv[i], "--server")) {
+            // 指定したソケットで待ち受けるコンパイルサーバとして動く
+            if (++i == argc) {
+                error("--server: missing socket path");
+            }
+            server = argv[i];
+            continue;
+        }
+        if (!strcmp(argv[i], "--client")) {
+            // 指定したソケットで待ち受けているサーバにコンパイルを任せる
+            // 環境変数 NINECC_SERVER で指定しても同じ
+            // --time-report や --cache-dir などサーバに伝えられないオプションがあるときは、自分でコンパイルする
+            if (++i == argc) {
+                error("--client: missing socket path");
+            }
+            server_path = argv[i];
+            continue;
+        }
+        if (!strcmp(argv[i], "--cache-dir")) {
+            // 関数ごとに生成したコードを指定したディレクトリにキャッシュし、次のコンパイルで再利用する
+            // 環境変数 NINECC_CACHE_DIR で指定しても同じ
+            if (++i == argc) {
+                error("--cache-dir: missing directory");
+            }
+            cache_dir = argv[i];
+            continue;
+        }
+        if (!strcmp(argv[i], "-c")) {
+            // 組み込みのアセンブラでアセンブルし、オブジェクトファイルを出力する
+            object_output = true;
+            continue;
+        }
+        if (!strcmp(argv[i], "-o")) {
+            // 出力先、指定がなければアセンブリは標準出力に、オブジェクトファイルは <入力>.o に出力する
+            if (++i == argc) {
+                error("-o: missing file name");
+            }
+            output = argv[i];
+            continue;
+        }
+        inputs[ninputs++] = argv[i];
     }
 
-    // トークナイズし、パースして AST を作る
-    filename = argv[1];
-    user_input = read_file(argv[1]);
-    token = tokenize();
-    Program *prog = program();
-    add_type(prog);
+    if (!cache_dir) {
+        cache_dir = getenv("NINECC_CACHE_DIR");
+    }
 
-#ifdef DEBUG
-    print_ast(prog);
-#endif
+    if (server) {
+        // -j で同時に処理する要求の数を指定できる
+        run_server(server, njobs > 0 ? njobs : get_nprocs());
+    }
+    if (!server_path) {
+        server_path = getenv("NINECC_SERVER");
+    }
+
+    if (ninputs == 0) {
+        error("Wrong number of arguments");
+    }
+    if (output && ninputs > 1) {
+        error("-o cannot be used with multiple input files");
+    }
 
-    // 各関数で使われる各ローカル変数にオフセットの情報を割り当てる
-    for (Function *fn = prog->fns; fn; fn = fn->next) {
-        int offset = 0;
-        for (VarList *vl = fn->locals; vl; vl = vl->next) {
-            Var *var = vl->var;
-            // 今から追加したい変数のサイズに応じて、必要ならパディングを追加
-            offset = align_to(offset, var->ty->align);
-            offset += size_of(var->ty, var->tok);
-            var->offset = offset;
+    // 入力が1つなら -o の指定先か標準出力に、複数なら入力ごとに .s ファイルに出力する
+    // オブジェクトファイルは端末に出力しても読めないので、-o がなければ .o ファイルに出力する
+    char **outputs = calloc(ninputs, sizeof(char *));
+    for (int i = 0; i < ninputs; i++) {
+        if (ninputs == 1 && (output || !object_output)) {
+            outputs[i] = output;
+        }
+        else {
+            outputs[i] = output_name(inputs[i], object_output ? ".o" : ".s");
         }
-        // char などでスタックサイズが8の倍数からずれる可能性があるので調整
-        fn->stack_size = align_to(offset, 8);
     }
 
-    codegen(prog);
+    if (njobs <= 0) {
+        njobs = get_nprocs();
+    }
+    if (njobs > ninputs) {
+        njobs = ninputs;
+    }
+    // ファイル単位で並列にコンパイルするときは、関数単位ではスレッドを増やさない
+    if (njobs > 1 && codegen_threads == 0) {
+        codegen_threads = 1;
+    }
+
+    CompileJob job = {};
+    job.inputs = inputs;
+    job.outputs = outputs;
+    job.elapsed = calloc(ninputs, sizeof(double));
+    job.ninputs = ninputs;
+    job.arena_stats = arena_stats;
+    job.report = report;
+    job.codegen_threads = codegen_threads;
+    atomic_init(&job.next, 0);
+
+    // 呼び出し元のスレッドも1つのワーカーとして働く
+    double start = now();
+    pthread_t *threads = malloc(sizeof(pthread_t) * njobs);
+    for (int i = 1; i < njobs; i++) {
+        if (pthread_create(&threads[i], NULL, compile_worker, &job)) {
+            error("cannot create a compile thread");
+        }
+    }
+    compile_worker(&job);
+    for (int i = 1; i < njobs; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    double wall = now() - start;
 
+    // 複数のファイルをコンパイルしたときは、ファイルごとの時間をまとめて表示する
+    if (ninputs > 1) {
+        double total = 0;
+        for (int i = 0; i < ninputs; i++) {
+            fprintf(stderr, "%10.2f ms  %s -> %s\n", job.elapsed[i] * 1e3, inputs[i], outputs[i]);
+            total += job.elapsed[i];
+        }
+        fprintf(stderr, "%10.2f ms  total for %d files (wall %.2f ms, -j %d)\n",
+                total * 1e3, ninputs, wall * 1e3, njobs);
+    }
     return 0;
 }
@@ -0,0 +1,235 @@
+#include <stdarg.h>
+#include <string.h>
+#include <setjmp.h>
+#include "9cc.h"
+#include "ninecc.h"
+
+#ifdef DEBUG
+#include "utility.h"
+#endif
+
+// ライブラリとして呼ばれている間は、エラーが起きても exit せずに ninecc_compile に戻る
+// コンパイル中の状態と同じくスレッドごとに持つ
+static _Thread_local jmp_buf *error_jmp;
+static _Thread_local char *error_msg;
+
+// 作ったエラーメッセージを報告する
+// ninecc_compile の中なら呼び出し元に戻り、そうでなければ表示して終了する
+// msg は malloc したものを渡す
+void raise_error(char *msg) {
+    if (error_jmp) {
+        error_msg = msg;
+        longjmp(*error_jmp, 1);
+    }
+
+    fprintf(stderr, "%s\n", msg);
+    exit(1);
+}
+
+// エラーを報告する前に、ほかのスレッドのために捕まえる
+// コード生成のワーカーのようにコンパイルを手伝うスレッドは、エラーをここで受け取り、
+// 呼び出し元のスレッドで raise_error しなおす
+// 捕まえたエラーがあればそのメッセージを、なければ NULL を返す
+char *catch_error(void (*fn)(void *), void *arg) {
+    jmp_buf buf;
+    jmp_buf *prev = error_jmp;
+    error_jmp = &buf;
+
+    char *msg = NULL;
+    if (setjmp(buf) == 0) {
+        fn(arg);
+    }
+    else {
+        msg = error_msg;
+        error_msg = NULL;
+    }
+
+    error_jmp = prev;
+    return msg;
+}
+
+// printf と同じ書式で、malloc した文字列を作る
+static char *vformat(char *fmt, va_list ap) {
+    va_list ap2;
+    va_copy(ap2, ap);
+    int len = vsnprintf(NULL, 0, fmt, ap2);
+    va_end(ap2);
+
+    char *buf = malloc(len + 1);
+    vsnprintf(buf, len + 1, fmt, ap);
+    return buf;
+}
+
+// エラーメッセージを出力して終了する
+void error(char *fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    char *msg = vformat(fmt, ap);
+    va_end(ap);
+    raise_error(msg);
+}
+
+// エラー箇所の行を示してエラーメッセージを出力し、終了する
+// foo.c:10: x = y + 1:
+//               ^ <error message here>
+static void verror_line(int line_num, char *line, char *loc, char *fmt, va_list ap) {
+    // loc から1文字ずつ進めながら行末の位置を探す
+    char *end = loc;
+    while (*end != '\n') {
+        end++;
+    }
+
+    // メッセージは1つの文字列にまとめてから報告する
+    // 複数のファイルを同時にコンパイルしていても、表示が混ざらない
+    char *msg;
+    size_t len;
+    FILE *fp = open_memstream(&msg, &len);
+
+    // ファイル名、行数、行の内容を表示
+    int indent = fprintf(fp, "%s:%d: ", filename, line_num);
+    // コードはヌル終端になっていないので1行で強制的に切る必要がある
+    // "." と "s" を組み合わせると、指定した文字数で切り捨てることができる
+    fprintf(fp, "%.*s\n", (int)(end - line), line);
+
+    // エラーメッセージを表示
+    int pos = loc - line + indent;
+    fprintf(fp, "%*s", pos, "");
+    fprintf(fp, "^ ");
+    vfprintf(fp, fmt, ap);
+    fclose(fp);
+
+    raise_error(msg);
+}
+
+void verror_at(char *loc, char *fmt, va_list ap) {
+    // トークナイザが作った行の表から、loc の行番号と行頭の位置を求める
+    char *line;
+    int line_num = find_line(loc, &line);
+    verror_line(line_num, line, loc, fmt, ap);
+}
+
+// エラー箇所を報告する
+void error_at(char *loc, char *fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    verror_at(loc, fmt, ap);
+}
+
+// トークンの位置を示してエラーを報告する
+// トークンは自分の行番号と桁を持っているので、行の表を引かなくてよい
+// コード生成のワーカーのように、行の表を持たないスレッドからも呼べる
+void error_tok(Token *tok, char *fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    if (tok) {
+        verror_line(tok->line, tok->str - (tok->col - 1), tok->str, fmt, ap);
+    }
+
+    raise_error(vformat(fmt, ap));
+}
+
+// 各関数で使われる各ローカル変数にオフセットの情報を割り当てる
+static void assign_offsets(Program *prog) {
+    for (Function *fn = prog->fns; fn; fn = fn->next) {
+        if (fn->cached) {
+            continue;
+        }
+        int offset = 0;
+        for (VarList *vl = fn->locals; vl; vl = vl->next) {
+            Var *var = vl->var;
+            // 今から追加したい変数のサイズに応じて、必要ならパディングを追加
+            offset = align_to(offset, var->ty->align);
+            offset += size_of(var->ty, var->tok);
+            var->offset = offset;
+        }
+        // char などでスタックサイズが8の倍数からずれる可能性があるので調整
+        fn->stack_size = align_to(offset, 8);
+    }
+}
+
+// filename と user_input に設定したソースコードをコンパイルし、
+// アセンブリを emit の出力先に出力する
+// 各フェーズの時間と各種のカウンタを stats に記録する
+void compile() {
+    reset_stats();
+
+    // トークナイズし、パースして AST を作る
+    // 字句解析はパースしながら少しずつ行うので、その時間はパースの時間から除く
+    double t0 = now();
+    token = tokenize();
+    Program *prog = program();
+    double t1 = now();
+    stats.phase_time[PHASE_PARSE] = t1 - t0 - stats.phase_time[PHASE_TOKENIZE];
+
+    // キャッシュにコードがある関数は、型付けとコード生成を飛ばす
+    cache_lookup(prog);
+    double t2 = now();
+    stats.phase_time[PHASE_CACHE] = t2 - t1;
+
+    add_type(prog);
+    double t3 = now();
+    stats.phase_time[PHASE_ADD_TYPE] = t3 - t2;
+
+#ifdef DEBUG
+    print_ast(prog);
+#endif
+
+    assign_offsets(prog);
+    double t4 = now();
+    stats.phase_time[PHASE_OFFSETS] = t4 - t3;
+
+    codegen(prog);
+    stats.phase_time[PHASE_CODEGEN] = now() - t4;
+    stats.insns = emit_insn_count();
+}
+
+int ninecc_compile(char *name, char *src, size_t len, char **out, size_t *out_len,
+                   ninecc_error_fn *on_error, void *arg) {
+    // トークナイザは入力が改行と NUL で終わっていることを前提にしているので、
+    // 末尾を足したコピーを作る
+    char *input = malloc(len + 2);
+    memcpy(input, src, len);
+    if (len == 0 || input[len - 1] != '\n') {
+        input[len++] = '\n';
+    }
+    input[len] = '\0';
+
+    jmp_buf buf;
+    jmp_buf *prev = error_jmp;
+    error_jmp = &buf;
+
+    int ret = 0;
+    if (setjmp(buf) == 0) {
+        filename = name;
+        user_input = input;
+        emit_open_mem();
+        compile();
+        *out = emit_close_mem(out_len);
+    }
+    else {
+        // エラーで中断した場合、出力途中のアセンブリは次の emit_open_mem で捨てられる
+        if (on_error) {
+            on_error(arg, error_msg);
+        }
+        free(error_msg);
+        error_msg = NULL;
+        ret = -1;
+    }
+
+    error_jmp = prev;
+
+    // 次の呼び出しのために、このコンパイルで確保したものを解放する
+    arena_reset_all();
+    free(input);
+    user_input = NULL;
+    filename = NULL;
+    return ret;
+}
+
+void ninecc_release() {
+    release_tokenizer();
+    release_parser();
+    release_types();
+    emit_release();
+    arena_release_all();
+}
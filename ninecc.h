@@ -0,0 +1,25 @@
+#ifndef __NINECC_H__
+#define __NINECC_H__
+
+#include <stddef.h>
+
+// 9cc をライブラリ(libninecc.a)として使うための API
+// コンパイル中の状態はスレッドごとに持つので、
+// 1つのプロセスの中で繰り返し呼んでよく、複数のスレッドから同時に呼んでもよい
+
+// コンパイルエラーを受け取るコールバック
+// msg はエラー箇所を含むメッセージで、コールバックから戻ると解放される
+typedef void ninecc_error_fn(void *arg, char *msg);
+
+// ファイル名 name、長さ len のソースコード src をコンパイルし、アセンブリを返す
+// 成功したら 0 を返し、*out に malloc したアセンブリ(NUL 終端)を、*out_len にその長さを入れる
+// *out は呼び出し側が free する
+// 失敗したら on_error を呼んだあと -1 を返す、on_error は NULL でもよい
+int ninecc_compile(char *name, char *src, size_t len, char **out, size_t *out_len,
+                   ninecc_error_fn *on_error, void *arg);
+
+// 呼び出したスレッドがコンパイルのために確保したまま持っているメモリを解放する
+// ninecc_compile を呼んだスレッドを終了する前に呼ぶ
+void ninecc_release();
+
+#endif
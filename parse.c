@@ -1,12 +1,20 @@
+#include <stddef.h>
 #include <string.h>
+#include <sys/mman.h>
 #include "9cc.h"
 
+// スコープに登録される名前の共通部分
+typedef struct ScopeEntry ScopeEntry;
+struct ScopeEntry {
+    ScopeEntry *next;   // 同じバケットにつながる次のエントリ
+    char *name;         // intern された名前
+    int depth;          // 登録したときのスコープの深さ
+};
+
 // ローカル変数、グローバル変数、typedef、enum が登録される
 typedef struct VarScope VarScope;
 struct VarScope {
-    VarScope *next;
-    char *name;
-    int depth;
+    ScopeEntry entry;
     Var *var;
     Type *type_def;
     Type *enum_ty;
@@ -16,80 +24,303 @@ struct VarScope {
 // 構造体定義が登録される
 typedef struct TagScope TagScope;
 struct TagScope {
-    TagScope *next;
-    char *name;
-    int depth;
+    ScopeEntry entry;
     Type *ty;
 };
 
+// intern された名前をキーにしたハッシュ表
+// 同じ名前のエントリはあとから登録したものがバケットの先頭にくるので
+// 内側のスコープで定義された名前が先に見つかる
+// 登録したエントリは log に登録順で記録しておき、
+// スコープを抜けるときは log を巻き戻して、そのスコープで登録したエントリを取り除く
+typedef struct {
+    ScopeEntry **buckets;
+    int capacity;       // バケットの数 (2のべき乗)
+    ScopeEntry **log;   // 登録順に並べたエントリ
+    int len;            // 登録されているエントリの数
+    int log_capacity;
+} SymbolTable;
+
+// enter_scope した時点での各表のエントリの数
+// leave_scope でこの数まで巻き戻す
 typedef struct {
-    VarScope *var_scope;
-    TagScope *tag_scope;
+    int var_len;
+    int tag_len;
 } Scope;
 
-VarList *globals;       // グローバル変数のリスト
-VarList *locals;        // ローカル変数のリスト
+// パース中の状態はコンパイルしているスレッドごとに持つ
+_Thread_local VarList *globals;         // グローバル変数のリスト
+_Thread_local VarList *locals;          // ローカル変数のリスト
+
+_Thread_local SymbolTable var_scope;    // 今のスコープで見える変数・typedef・enum 定数
+_Thread_local SymbolTable tag_scope;    // 今のスコープで見えるタグ
+_Thread_local int scope_depth;          // 今のスコープのネストの深さ
+
+_Thread_local Node *current_switch;
+
+// 文字列リテラルなどに付けるラベルの連番
+static _Thread_local int data_label_seq;
+// 本体をパースしている関数の名前と、その関数の中で付けたラベルの連番
+// 関数の外では current_fn は NULL
+static _Thread_local char *current_fn;
+static _Thread_local int fn_label_seq;
+
+// パース中のノードを置く領域
+// 関数のノードを1つの連続した領域に並べるため、NodeId で指せる大きさの仮想アドレス空間を予約し、
+// 使った分だけ書き込めるようにしていく
+// 関数を読み終えたら使った部分を Function に写し、次の関数のために先頭から使い直す
+#define NODE_REGION_SIZE ((size_t)1 << 32)
+#define NODE_COMMIT_SIZE (1024 * 1024)
+
+_Thread_local char *node_base;
+static _Thread_local char *node_region;
+static _Thread_local size_t node_committed;    // 書き込めるようにした大きさ
+static _Thread_local size_t node_used;         // 使った大きさ
+
+static int hash_name(char *name, int capacity) {
+    // intern された名前はアドレスで区別できるので、アドレスをそのままハッシュする
+    unsigned long h = (unsigned long)name >> 3;
+    return (h * 2654435761u) & (capacity - 1);
+}
+
+// バケットを倍に広げる
+// log を古い順にたどって先頭に入れ直せば、同名のエントリの順序も保たれる
+static void rehash(SymbolTable *tab) {
+    tab->capacity = tab->capacity ? tab->capacity * 2 : 256;
+    free(tab->buckets);
+    tab->buckets = calloc(tab->capacity, sizeof(ScopeEntry *));
+
+    for (int i = 0; i < tab->len; i++) {
+        ScopeEntry *e = tab->log[i];
+        int h = hash_name(e->name, tab->capacity);
+        e->next = tab->buckets[h];
+        tab->buckets[h] = e;
+    }
+}
+
+static void table_push(SymbolTable *tab, ScopeEntry *e, char *name) {
+    if (tab->len == tab->log_capacity) {
+        tab->log_capacity = tab->log_capacity ? tab->log_capacity * 2 : 256;
+        tab->log = realloc(tab->log, sizeof(ScopeEntry *) * tab->log_capacity);
+    }
+    tab->log[tab->len++] = e;
+
+    e->name = name;
+    e->depth = scope_depth;
+
+    // エントリがバケットの数の2倍を超えたら広げる
+    if (tab->len > tab->capacity * 2) {
+        rehash(tab);
+        return;
+    }
+    int h = hash_name(name, tab->capacity);
+    e->next = tab->buckets[h];
+    tab->buckets[h] = e;
+}
+
+static ScopeEntry *table_find(SymbolTable *tab, char *name) {
+    if (!tab->capacity) {
+        return NULL;
+    }
+    stats.lookups++;
+    for (ScopeEntry *e = tab->buckets[hash_name(name, tab->capacity)]; e; e = e->next) {
+        stats.lookup_steps++;
+        if (e->name == name) {
+            return e;
+        }
+    }
+    return NULL;
+}
 
-VarScope *var_scope;    // 今のスコープで定義されている変数のリスト
-TagScope *tag_scope;    // 今のスコープで定義されているタグのリスト
-int scope_depth;        // todo: 今のスコープのネストの深さ
+// len 個のエントリが残るまで、新しいものから順に取り除く
+// 取り除くエントリは必ずバケットの先頭にある
+static void table_rewind(SymbolTable *tab, int len) {
+    while (tab->len > len) {
+        ScopeEntry *e = tab->log[--tab->len];
+        tab->buckets[hash_name(e->name, tab->capacity)] = e->next;
+    }
+}
 
-Node *current_switch;
+// 表を空にする
+// 前の入力で登録したエントリは領域ごと捨てられているかもしれないので、log はたどらない
+static void table_clear(SymbolTable *tab) {
+    if (tab->buckets) {
+        memset(tab->buckets, 0, sizeof(ScopeEntry *) * tab->capacity);
+    }
+    tab->len = 0;
+}
 
-Scope *enter_scope() {
-    Scope *sc = calloc(1, sizeof(Scope));
-    sc->var_scope = var_scope;
-    sc->tag_scope = tag_scope;
+static void table_free(SymbolTable *tab) {
+    free(tab->buckets);
+    free(tab->log);
+    *tab = (SymbolTable){};
+}
+
+// このスレッドのパーサが持っている表とノードの領域を解放する
+void release_parser() {
+    table_free(&var_scope);
+    table_free(&tag_scope);
+    if (node_region) {
+        munmap(node_region, NODE_REGION_SIZE);
+        node_region = NULL;
+        node_committed = 0;
+        node_base = NULL;
+    }
+}
+
+Scope enter_scope() {
+    Scope sc = {var_scope.len, tag_scope.len};
     ++scope_depth;
     return sc;
 }
 
-void leave_scope(Scope *sc) {
-    var_scope = sc->var_scope;
-    tag_scope = sc->tag_scope;
+void leave_scope(Scope sc) {
+    table_rewind(&var_scope, sc.var_len);
+    table_rewind(&tag_scope, sc.tag_len);
     --scope_depth;
 }
 
-// 今パースしている関数のスコープ内で定義されている変数と typedef のリストの中から
+// 今パースしている関数のスコープ内で定義されている変数と typedef の中から
 // tok を探す
 VarScope *find_var(Token *tok) {
-    for (VarScope *sc = var_scope; sc; sc = sc->next) {
-        if (strlen(sc->name) == tok->len && !memcmp(tok->str, sc->name, tok->len)) {
-            return sc;
-        }
+    return (VarScope *)table_find(&var_scope, tok->name);
+}
+
+// 今パースしている関数のスコープ内で定義されているタグの中から tok を探す
+TagScope *find_tag(Token *tok) {
+    return (TagScope *)table_find(&tag_scope, tok->name);
+}
+
+// 最後に使うフィールドまでの大きさ
+#define NODE_SIZE_TO(field) (offsetof(Node, field) + sizeof(((Node *)0)->field))
+
+// kind の種類のノードに必要な大きさを返す
+size_t node_size(NodeKind kind) {
+    switch (kind) {
+    case ND_NUM:
+        return NODE_SIZE_TO(val);
+    case ND_VAR:
+        return NODE_SIZE_TO(var);
+    case ND_ADD:
+    case ND_SUB:
+    case ND_MUL:
+    case ND_DIV:
+    case ND_BITAND:
+    case ND_BITOR:
+    case ND_BITXOR:
+    case ND_SHL:
+    case ND_SHR:
+    case ND_ASSIGN:
+    case ND_A_ADD:
+    case ND_A_SUB:
+    case ND_A_MUL:
+    case ND_A_DIV:
+    case ND_A_SHL:
+    case ND_A_SHR:
+    case ND_COMMA:
+    case ND_LOGAND:
+    case ND_LOGOR:
+    case ND_EQ:
+    case ND_NE:
+    case ND_LT:
+    case ND_LE:
+        return NODE_SIZE_TO(rhs);
+    case ND_PRE_INC:
+    case ND_PRE_DEC:
+    case ND_POST_INC:
+    case ND_POST_DEC:
+    case ND_ADDR:
+    case ND_DEREF:
+    case ND_NOT:
+    case ND_BITNOT:
+    case ND_RETURN:
+    case ND_SIZEOF:
+    case ND_EXPR_STMT:
+    case ND_CAST:
+        return NODE_SIZE_TO(lhs);
+    case ND_MEMBER:
+        return NODE_SIZE_TO(member);
+    case ND_GOTO:
+    case ND_LABEL:
+        return NODE_SIZE_TO(label_name);
+    case ND_CASE:
+        return NODE_SIZE_TO(case_end_label);
+    case ND_WHILE:
+        return NODE_SIZE_TO(then);
+    case ND_IF:
+    case ND_TERNARY:
+        return NODE_SIZE_TO(els);
+    case ND_FOR:
+        return NODE_SIZE_TO(inc);
+    case ND_SWITCH:
+        return NODE_SIZE_TO(default_case);
+    case ND_BLOCK:
+    case ND_STMT_EXPR:
+        return NODE_SIZE_TO(body);
+    case ND_FUNCALL:
+        return NODE_SIZE_TO(args);
+    default:
+        // ND_BREAK, ND_CONTINUE, ND_NULL は共通の部分だけでよい
+        return offsetof(Node, val);
     }
+}
 
-    return NULL;
+// ノードの領域を空にして、これから作るノードを先頭から並べる
+static void reset_nodes() {
+    if (!node_region) {
+        node_region = mmap(NULL, NODE_REGION_SIZE, PROT_NONE,
+                           MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (node_region == MAP_FAILED) {
+            node_region = NULL;
+            error("cannot reserve memory for AST nodes: %s", strerror(errno));
+        }
+    }
+    node_base = node_region;
+    // NodeId の 0 はノードがないことを表すので、先頭は使わない
+    node_used = 8;
 }
 
-// 今パースしている関数のスコープ内で定義されているタグリストの中から tok を探す
-TagScope *find_tag(Token *tok) {
-    for (TagScope *sc = tag_scope; sc; sc = sc->next) {
-        if (strlen(sc->name) == tok->len && !memcmp(tok->str, sc->name, tok->len)) {
-            return sc;
+static void *alloc_node(size_t size) {
+    size = align_to(size, 8);
+    if (node_used + size > node_committed) {
+        if (node_used + size > NODE_REGION_SIZE) {
+            error("function too large");
         }
+        size_t len = align_to(node_used + size - node_committed, NODE_COMMIT_SIZE);
+        if (node_committed + len > NODE_REGION_SIZE) {
+            len = NODE_REGION_SIZE - node_committed;
+        }
+        if (mprotect(node_region + node_committed, len, PROT_READ | PROT_WRITE) < 0) {
+            error("cannot allocate memory for AST nodes: %s", strerror(errno));
+        }
+        node_committed += len;
     }
 
-    return NULL;
+    // 領域は関数ごとに使い直すので、前の関数のノードが残っている
+    void *p = node_region + node_used;
+    memset(p, 0, size);
+    node_used += size;
+    return p;
 }
 
 Node *new_node(NodeKind kind, Token *tok) {
-    Node *node = calloc(1, sizeof(Node));
+    Node *node = alloc_node(node_size(kind));
     node->kind = kind;
-    node->tok = tok;
+    node->tok = keep_token(tok);
+    stats.nodes[kind]++;
     return node;
 }
 
 Node *new_binary(NodeKind kind, Node *lhs, Node *rhs, Token *tok) {
     Node *node = new_node(kind, tok);
-    node->lhs = lhs;
-    node->rhs = rhs;
+    node->lhs = node_id(lhs);
+    node->rhs = node_id(rhs);
     return node;
 }
 
 Node *new_unary(NodeKind kind, Node *expr, Token *tok) {
     Node *node = new_node(kind, tok);
-    node->lhs = expr;
+    node->lhs = node_id(expr);
     return node;
 }
 
@@ -107,23 +338,20 @@ Node *new_var(Var *var, Token *tok) {
 
 // スコープに変数を追加する
 VarScope *push_scope(char *name) {
-    VarScope *sc = calloc(1, sizeof(VarScope));
-    sc->name = name;
-    sc->next = var_scope;
-    sc->depth = scope_depth;
-    var_scope = sc;
+    VarScope *sc = arena_alloc(ARENA_SCOPE, sizeof(VarScope));
+    table_push(&var_scope, &sc->entry, name);
     return sc;
 }
 
 // 新しい変数のエントリを作って変数リストに足し、新しく作った変数を返す
 Var *push_var(char *name, Type *ty, bool is_local, Token *tok) {
-    Var *var = calloc(1, sizeof(Var));
+    Var *var = arena_alloc(ARENA_SCOPE, sizeof(Var));
     var->name = name;
     var->ty = ty;
     var->is_local = is_local;
-    var->tok = tok;
+    var->tok = keep_token(tok);
 
-    VarList *vl = calloc(1, sizeof(VarList));
+    VarList *vl = arena_alloc(ARENA_SCOPE, sizeof(VarList));
     vl->var = var;
 
     // ローカル変数かグローバル変数かで追加するリストを変える
@@ -151,14 +379,30 @@ Type *find_typedef(Token *tok) {
 }
 
 char *new_label() {
-    static int cnt = 0;
-    char buf[20];
-    sprintf(buf, ".L.data.%d", cnt++);
-    return strndup(buf, 20);
+    if (!current_fn) {
+        char buf[20];
+        sprintf(buf, ".L.data.%d", data_label_seq++);
+        return arena_strndup(buf, 20);
+    }
+
+    // 関数の中で作るラベルには関数名と関数ごとの連番を使う
+    // 前の関数を書き換えても名前が変わらないので、この関数のコードをキャッシュから再利用できる
+    int seq = fn_label_seq++;
+    int len = snprintf(NULL, 0, ".L.data.%s.%d", current_fn, seq);
+    char *buf = arena_alloc(ARENA_TOKEN, len + 1);
+    sprintf(buf, ".L.data.%s.%d", current_fn, seq);
+    return buf;
 }
 
-Function *function();
-Type *type_specifier();
+// 宣言につけられた typedef と static
+// 型は同じものを共有するので、型ではなく宣言ごとにこの構造体で受け渡す
+typedef struct {
+    bool is_typedef;
+    bool is_static;
+} VarAttr;
+
+Function *function(Type *ty, char *name, Token *tok, Token *start);
+Type *type_specifier(VarAttr *attr);
 Type *declarator(Type *ty, char **name);
 Type *abstract_declarator(Type *ty);
 Type *type_suffix(Type *ty);
@@ -166,7 +410,7 @@ Type *type_name();
 Type *struct_decl();
 Type *enum_specifier();
 Member *struct_member();
-void global_var();
+void global_var(Type *ty, char *name, Token *tok);
 Node *declaration();
 bool is_typename();
 Node *stmt();
@@ -190,47 +434,64 @@ Node *unary();
 Node *postfix();
 Node *primary();
 
-bool is_function() {
-    // type_specifier や consume_ident などで先読みするとトークンを消費してしまう
-    // 最初にトークンの位置を控えておく
-    Token *tok = token;
-
-    Type *ty = type_specifier();
-    char *name = NULL;
-    declarator(ty, &name);
-    // 変数宣言か関数定義かは、識別子のあとに "(" が出てくるか見るまでわからない
-    bool isfunc = name && consume("(");
-
-    // 読み進めてしまったトークンを戻す
-    token = tok;
-    return isfunc;
-}
-
 // program = (global-var | function)*
 Program *program() {
     Function head;
     head.next = NULL;
     Function *cur = &head;
     globals = NULL;
+    current_switch = NULL;
+    data_label_seq = 0;
+    current_fn = NULL;
+    scope_depth = 0;
+    table_clear(&var_scope);
+    table_clear(&tag_scope);
+    reset_types();
+
+    // 関数のコードのキャッシュのキーに使う、それまでに読んだグローバルな宣言のハッシュ
+    uint64_t deps = CACHE_HASH_INIT;
 
     // プログラムは、グローバル変数の宣言か関数定義が複数並んだもの
     while (!at_eof()) {
-        if (is_function()) {
-            Function *fn = function();
-            if (!fn) {
-                continue;
+        // 前の宣言で作ったノードは、関数の本体なら Function に写してあり、
+        // それ以外は定数式の計算などに使い終えているので、領域を先頭から使い直す
+        reset_nodes();
+
+        // 関数定義もグローバル変数も type-specifier declarator で始まるので、ここまでは共通
+        // 関数の戻り値の型に構造体の定義が書かれていても、1回しかパースしない
+        Token *start = token;
+        Type *ty = type_specifier(NULL);
+        Token *tok = token;
+        char *name = NULL;
+        ty = declarator(ty, &name);
+
+        // 変数宣言か関数定義かは、識別子のあとに "(" が出てくるか見るまでわからない
+        Function *fn = NULL;
+        if (name && consume(PT_LPAREN)) {
+            fn = function(ty, name, tok, start);
+            if (fn) {
+                fn->deps = deps;
+                cur->next = fn;
+                cur = cur->next;
             }
-            cur->next = fn;
-            cur = cur->next;
-            continue;
+        }
+        else {
+            // グローバル変数の定義であって、現状では型定義のみの宣言はできない
+            // 関数定義の中の declaration は型定義のみの宣言に対応している
+            global_var(ty, name, tok);
         }
 
-        // グローバル変数の定義であって、現状では型定義のみの宣言はできない
-        // 関数定義の中の declaration は型定義のみの宣言に対応している
-        global_var();
+        if (cache_dir) {
+            // 関数の本体はほかの関数のコードに影響しないので、関数定義は本体の手前までを加える
+            char *end = fn ? fn->body : token->str;
+            deps = hash_bytes(deps, start->str, end - start->str);
+        }
+
+        // 読み終えた宣言のトークンはもう参照しないので解放する
+        release_tokens();
     }
 
-    Program *prog = calloc(1, sizeof(Program));
+    Program *prog = arena_alloc(ARENA_AST, sizeof(Program));
     prog->globals = globals;
     prog->fns = head.next;
     return prog;
@@ -245,7 +506,8 @@ Program *program() {
 //              | "long" | "long" "int" | "int" "long"
 // "typedef" と "static" は type-specifier 内のどこにでも現れる
 // 型宣言を読み取る
-Type *type_specifier() {
+// "typedef" と "static" があったかは attr に入れる、attr が NULL なら読み飛ばす
+Type *type_specifier(VarAttr *attr) {
     if (!is_typename(token)) {
         error_tok(token, "typename expected");
     }
@@ -268,37 +530,40 @@ Type *type_specifier() {
     int base_type = 0;
     Type *user_type = NULL;
 
-    bool is_typedef = false;
-    bool is_static = false;
+    VarAttr dummy;
+    if (!attr) {
+        attr = &dummy;
+    }
+    *attr = (VarAttr){};
 
     for (;;) {
         Token *tok = token;
 
-        if (consume("typedef")) {
-            is_typedef = true;
+        if (consume(KW_TYPEDEF)) {
+            attr->is_typedef = true;
         }
-        else if (consume("static")) {
-            is_static = true;
+        else if (consume(KW_STATIC)) {
+            attr->is_static = true;
         }
-        else if (consume("void")) {
+        else if (consume(KW_VOID)) {
             base_type += VOID;
         }
-        else if (consume("_Bool")) {
+        else if (consume(KW_BOOL)) {
             base_type += BOOL;
         }
-        else if (consume("char")) {
+        else if (consume(KW_CHAR)) {
             base_type += CHAR;
         }
-        else if (consume("short")) {
+        else if (consume(KW_SHORT)) {
             base_type += SHORT;
         }
-        else if (consume("int")) {
+        else if (consume(KW_INT)) {
             base_type += INT;
         }
-        else if (consume("long")) {
+        else if (consume(KW_LONG)) {
             base_type += LONG;
         }
-        else if (peek("struct")) {
+        else if (peek(KW_STRUCT)) {
             // 既になんらか型のトークン列を読んでいたら抜ける
             // int struct {...} というような場合は int だけ読んで抜ける
             // そのあと識別子がくることが期待されるのでパースエラーになるが…
@@ -308,7 +573,7 @@ Type *type_specifier() {
             // struct から始まっているのであれば構造体の宣言としてパース
             user_type = struct_decl();
         }
-        else if (peek("enum")) {
+        else if (peek(KW_ENUM)) {
             // 構造体と同様に、既になんらかの型のトークン列を読んでいたら抜ける
             if (base_type || user_type) {
                 break;
@@ -328,7 +593,7 @@ Type *type_specifier() {
                 break;
             }
             // 型の名前だったら break せずループを続ける
-            token = token->next;
+            token = next_token(token);
             user_type = ty;
         }
 
@@ -363,8 +628,6 @@ Type *type_specifier() {
         }
     }
 
-    ty->is_typedef = is_typedef;
-    ty->is_static = is_static;
     return ty;
 }
 
@@ -380,15 +643,15 @@ Type *declarator(Type *ty, char **name) {
     //      -> placeholder = array_of(int)
     //      -> pointer_to(array_of(int))
 
-    while (consume("*")) {
+    while (consume(PT_STAR)) {
         ty = pointer_to(ty);
     }
 
-    if (consume("(")) {
+    if (consume(PT_LPAREN)) {
         // ネストした型定義を深さ優先でパースするため、いったんプレースホルダを作る
-        Type *placeholder = calloc(1, sizeof(Type));
+        Type *placeholder = new_type(TY_VOID, 1);
         Type *new_ty = declarator(placeholder, name);
-        expect(")");
+        expect(PT_RPAREN);
         // プレースホルダに値としてコピー
         *placeholder = *type_suffix(ty);
         return new_ty;
@@ -401,14 +664,14 @@ Type *declarator(Type *ty, char **name) {
 // abstract-declarator = "*"* ( "(" abstract-declarator ")" )? type-suffix
 // 識別子のない型の記述をパース
 Type *abstract_declarator(Type *ty) {
-    while (consume("*")) {
+    while (consume(PT_STAR)) {
         ty = pointer_to(ty);
     }
 
-    if (consume("(")) {
-        Type *placeholder = calloc(1, sizeof(Type));
+    if (consume(PT_LPAREN)) {
+        Type *placeholder = new_type(TY_VOID, 1);
         Type *new_ty = abstract_declarator(placeholder);
-        expect(")");
+        expect(PT_RPAREN);
         // 後ろの配列宣言のところまでパースしたあと、プレースホルダを差し替え
         *placeholder = *type_suffix(ty);
         return new_ty;
@@ -420,51 +683,49 @@ Type *abstract_declarator(Type *ty) {
 // type-suffix = ( "[" const-expr? "]" type-suffix)?
 // 型の後置修飾語(配列の括弧)をパース(配列の要素数がない場合もある)
 Type *type_suffix(Type *ty) {
-    if (!consume("[")) {
+    if (!consume(PT_LBRACKET)) {
         return ty;
     }
 
     int sz = 0;
     bool is_incomplete = true;
-    if (!consume("]")) {
+    if (!consume(PT_RBRACKET)) {
         sz = const_expr();
         is_incomplete = false;
-        expect("]");
+        expect(PT_RBRACKET);
     }
     // 配列の要素数がない場合は incomplete である
 
     // さらに後ろをパースし、配列型とする
     ty = type_suffix(ty);
-    ty = array_of(ty, sz);
-    ty->is_incomplete = is_incomplete;
-    return ty;
+    if (is_incomplete) {
+        return incomplete_array_of(ty);
+    }
+    return array_of(ty, sz);
 }
 
 // type-name = type-specifier abstract-declarator type-suffix
 // type-declarator ではなく abstract-declarator になっている
 // 識別子なしの型宣言部だけを
 Type *type_name() {
-    Type *ty = type_specifier();
+    Type *ty = type_specifier(NULL);
     ty = abstract_declarator(ty);
     return type_suffix(ty);
 }
 
 // スコープに型名を追加する
 void push_tag_scope(Token *tok, Type *ty) {
-    TagScope *sc = calloc(1, sizeof(TagScope));
-    sc->next = tag_scope;
-    sc->name = strndup(tok->str, tok->len);
-    sc->depth = scope_depth;
+    TagScope *sc = arena_alloc(ARENA_SCOPE, sizeof(TagScope));
     sc->ty = ty;
-    tag_scope = sc;
+    table_push(&tag_scope, &sc->entry, tok->name);
 }
 
 // struct-decl = "struct" ident? ("{" struct-member "}")?
 Type *struct_decl() {
-    expect("struct");
+    expect(KW_STRUCT);
     Token *tag = consume_ident();
 
-    if (tag && !peek("{")) {
+    if (tag && !peek(PT_LBRACE)) {
         // "struct" のあとに識別子があり、次のトークンが "{" でない場合は struct tag
         // e.g., struct Position p;
 
@@ -493,7 +754,7 @@ Type *struct_decl() {
     // e.g., struct { int x; int y; }
     //       struct Position { int x; int y; }
     // ただ "struct *foo" は正しい C の定義で、foo は未定義の構造体型へのポインタ型となる
-    if (!consume("{")) {
+    if (!consume(PT_LBRACE)) {
         // 識別子はなく、次のトークンが "{" でもない、つまりなんの構造体を指しているかわからない
         // 構造体名が指定されないけどポインタとして変数定義されている場合は
         // とりあえず構造体として扱う
@@ -503,10 +764,10 @@ Type *struct_decl() {
     }
 
     // 構造体名が書かれている場合は探す
-    TagScope *sc = find_tag(tag);
+    TagScope *sc = tag ? find_tag(tag) : NULL;
     Type *ty;
 
-    if (sc && sc->depth == scope_depth) {
+    if (sc && sc->entry.depth == scope_depth) {
         // 同じ階層に同じ型名が構造体以外として定義されていたら再定義エラー
         if (sc->ty->kind != TY_STRUCT) {
             error_tok(tag, "not a struct tag");
@@ -530,7 +791,7 @@ Type *struct_decl() {
     Member *cur = &head;
 
     // メンバの定義をパース
-    while (!consume("}")) {
+    while (!consume(PT_RBRACE)) {
         cur->next = struct_member();
         cur = cur->next;
     }
@@ -557,6 +818,7 @@ Type *struct_decl() {
 
     // メンバ定義のパースまで終わったら構造体の定義は完了なので incomplete フラグは消す
     ty->is_incomplete = false;
+    ty->size = align_to(offset, ty->align);
 
     return ty;
 }
@@ -564,14 +826,14 @@ Type *struct_decl() {
 // enum-list = enum-elem ("," enum-elem)* ","?
 // enum-elem = ident ("=" const-expr)?
 Type *enum_specifier() {
-    expect("enum");
+    expect(KW_ENUM);
     Type *ty = enum_type();
 
     // enum の型名が書いてあって、かつその後ろに開きかっこがないのであれば
     // enum の定義ではなく、その enum 型の変数の定義をしている
     // e.g., enum Color {red, blue}; enum Color c;
     Token *tag = consume_ident();
-    if (tag && !peek("{")) {
+    if (tag && !peek(PT_LBRACE)) {
         // スコープに enum の定義があるはず
         TagScope *sc = find_tag(tag);
         if (!sc) {
@@ -584,14 +846,14 @@ Type *enum_specifier() {
     }
 
     // 開きかっこがある場合は enum の定義
-    expect("{");
+    expect(PT_LBRACE);
 
     // enum-list のパース
     int cnt = 0;
     for (;;) {
         char *name = expect_ident();
         // enum の定数値に値が指定されている場合
-        if (consume("=")) {
+        if (consume(PT_ASSIGN)) {
             cnt = const_expr();
         }
 
@@ -600,14 +862,14 @@ Type *enum_specifier() {
         sc->enum_ty = ty;
         sc->enum_val = cnt++;
 
-        if (consume(",")) {
-            if (consume("}")) {
+        if (consume(PT_COMMA)) {
+            if (consume(PT_RBRACE)) {
                 break;
             }
             continue;
         }
 
-        expect("}");
+        expect(PT_RBRACE);
         break;
     }
 
@@ -620,24 +882,24 @@ Type *enum_specifier() {
 
 // struct-member = type-specifier declarator type-suffix ";"
 Member *struct_member() {
-    Type *ty = type_specifier();
+    Type *ty = type_specifier(NULL);
     Token *tok = token;
     char *name = NULL;
     ty = declarator(ty, &name);
     ty = type_suffix(ty);
-    expect(";");
+    expect(PT_SEMICOLON);
 
-    Member *mem = calloc(1, sizeof(Member));
+    Member *mem = arena_alloc(ARENA_TYPE, sizeof(Member));
     mem->name =name;
     mem->ty = ty;
-    mem->tok = tok;
+    mem->tok = keep_token(tok);
     return mem;
 }
 
 // 関数引数の宣言を1つ分読み取る
 // e.g., "int *x[10]"
 VarList *read_func_param() {
-    Type *ty = type_specifier();
+    Type *ty = type_specifier(NULL);
     Token *tok = token;
     char *name = NULL;
     ty = declarator(ty, &name);
@@ -652,14 +914,14 @@ VarList *read_func_param() {
     Var *var = push_var(name, ty, true, tok);
     push_scope(name)->var = var;
 
-    VarList *vl = calloc(1, sizeof(VarList));
+    VarList *vl = arena_alloc(ARENA_SCOPE, sizeof(VarList));
     vl->var = var;
     return vl;
 }
 
 VarList *read_func_params() {
     // 引数なしなら NULL を返す
-    if (consume(")")) {
+    if (consume(PT_RPAREN)) {
         return NULL;
     }
 
@@ -668,8 +930,8 @@ VarList *read_func_params() {
     VarList *cur = head;
 
     // 閉じ括弧がくるまで変数をパースしてリストにつなげていく
-    while (!consume(")")) {
-        expect(",");
+    while (!consume(PT_RPAREN)) {
+        expect(PT_COMMA);
         cur->next = read_func_param();
         cur = cur->next;
     }
@@ -680,46 +942,53 @@ VarList *read_func_params() {
 // function = type-specifier declarator "(" params? ")" ( "{" stmt* "}" | ";")
 // params   = param ("," param)*
 // param    = type-specifier declarator type-suffix
-Function *function() {
+// type-specifier declarator "(" までは program で読み終えており、その結果を引数で受け取る
+// start は関数定義の最初のトークン
+Function *function(Type *ty, char *name, Token *tok, Token *start) {
     // パース中に使う変数の辞書をクリア
     locals = NULL;
 
-    Type *ty = type_specifier();
-    Token *tok = token;
-    char *name = NULL;
-    ty = declarator(ty, &name);
-
     // 関数の名前と型の組み合わせをスコープに追加する
     Var *var = push_var(name, func_type(ty), false, tok);
     push_scope(name)->var = var;
 
-    Function *fn = calloc(1, sizeof(Function));
+    Function *fn = arena_alloc(ARENA_AST, sizeof(Function));
     fn->name = name;
-
-    expect("(");
     fn->params = read_func_params();
 
-    if (consume(";")) {
+    if (consume(PT_SEMICOLON)) {
         return NULL;
     }
 
     // 関数の本体をパース
-    expect("{");
+    fn->src = start->str;
+    fn->body = token->str;
+    expect(PT_LBRACE);
+    current_fn = name;
+    fn_label_seq = 0;
     Node head;
-    head.next = NULL;
+    head.next = 0;
     Node *cur = &head;
 
     // 複数の文を前から順番にリストに追加していく
-    while (!consume("}")) {
+    Token *end;
+    while (!(end = consume(PT_RBRACE))) {
         // 関数の中身は複数の stmt からなる
-        cur->next = stmt();
-        cur = cur->next;
+        cur->next = node_id(stmt());
+        cur = node_at(cur->next);
     }
+    fn->src_end = end->str + end->len;
+    current_fn = NULL;
 
     // head はダミーのノードなので、その次のノードから使う
     fn->node = head.next;
+    // この関数のノードはノードの領域の先頭から並んでいるので、まとめて写して持たせる
+    // ノードは互いを領域の先頭からの位置で指しているので、写しても書き換えなくてよい
+    fn->nodes_size = node_used;
+    fn->nodes = arena_alloc(ARENA_AST, node_used);
+    memcpy(fn->nodes, node_region, node_used);
     // パース中に作ったローカル変数一覧をそのまま渡す
-    // calloc してあるのでこの関数を抜けても問題ない
+    // アリーナに確保してあるのでこの関数を抜けても問題ない
     fn->locals = locals;
     return fn;
 }
@@ -727,109 +996,112 @@ Function *function() {
 // 初期化リストの末尾にいるかどうかを判定する
 // 初期化リストは "}" か ",}" で終わる
 bool peek_end() {
-    Token *tok = token;
-    bool ret = consume("}") || (consume(",") && consume("}"));
+    Token *mark = mark_token();
+    bool ret = consume(PT_RBRACE) || (consume(PT_COMMA) && consume(PT_RBRACE));
     // 消費したトークンを戻す
-    token = tok;
+    rewind_token(mark);
     return ret;
 }
 
 // 初期化リストの末尾をパース
 void expect_end() {
-    Token *tok = token;
-    if (consume(",") && consume("}")) {
+    Token *mark = mark_token();
+    if (consume(PT_COMMA) && consume(PT_RBRACE)) {
+        drop_mark();
         return;
     }
-    token = tok;
-    expect("}");
-}
-
-// 指定された値で初期化する初期化子
-Initializer *new_init_val(Initializer *cur, int sz, int val) {
-    Initializer *init = calloc(1, sizeof(Initializer));
-    init->sz = sz;
-    init->val = val;
-    cur->next = init;
-    return init;
-}
-
-// 他変数へのポインタで初期化する初期化子
-Initializer *new_init_label(Initializer *cur, char *label) {
-    Initializer *init = calloc(1, sizeof(Initializer));
-    init->label = label;
-    cur->next = init;
-    return init;
+    rewind_token(mark);
+    expect(PT_RBRACE);
 }
 
-// 指定された数のゼロで初期化する初期化子
-Initializer *new_init_zero(Initializer *cur, int nbytes) {
-    for (int i = 0; i < nbytes; i++) {
-        cur = new_init_val(cur, 1, 0);
+// 初期値のバイト列の offset バイト目から sz バイトを書き込む場所を返す
+// 大きさの決まっていない配列も初期化できるよう、足りなければバイト列を広げる
+// 書き込まなかった部分は 0 のまま残る
+static char *init_bytes(Initializer *init, int offset, int sz) {
+    int end = offset + sz;
+    if (end > init->cap) {
+        int cap = init->cap ? init->cap : 64;
+        while (cap < end) {
+            cap *= 2;
+        }
+        char *data = arena_alloc(ARENA_AST, cap);
+        if (init->len) {
+            memcpy(data, init->data, init->len);
+        }
+        init->data = data;
+        init->cap = cap;
     }
-    return cur;
-}
-
-// 指定された文字列で初期化する初期化子
-Initializer *gvar_init_string(char *p, int len) {
-    Initializer head;
-    head.next = NULL;
-    Initializer *cur = &head;
-    for (int i = 0; i < len; i++) {
-        cur = new_init_val(cur, 1, p[i]);
+    if (end > init->len) {
+        init->len = end;
     }
-    return head.next;
+    return init->data + offset;
 }
 
-// 構造体のパディング部分を埋める初期化子
-Initializer *emit_struct_padding(Initializer *cur, Type *parent, Member *mem) {
-    // 対象のメンバの終端の位置を計算
-    int end = mem->offset + size_of(mem->ty, token);
-
-    // 出力するパディングのサイズ
-    int padding;
-    if (mem->next) {
-        // 次のメンバがある場合は、次のメンバの開始位置との差を計算
-        padding = mem->next->offset - end;
-    }
-    else {
-        // 次のメンバがない場合(最後のメンバの場合)は、親である構造体のサイズとの差を計算
-        padding = size_of(parent, token) - end;
+// 初期値の offset バイト目に sz バイトの値 val を書き込む
+static void init_val(Initializer *init, int offset, int sz, long val) {
+    // x86-64 はリトルエンディアンなので、下位のバイトから並べる
+    char *p = init_bytes(init, offset, sz);
+    for (int i = 0; i < sz; i++) {
+        p[i] = val >> (i * 8);
     }
+}
 
-    // パディングが必要な場合のみ 0 埋めする初期化子を追加
-    if (padding) {
-        cur = new_init_zero(cur, padding);
+// 初期値の offset バイト目から、文字列リテラル tok で長さ sz の char の配列を初期化する
+// 配列のほうが短ければ切り詰め、長ければ残りは 0 のまま
+static void init_string(Initializer *init, int offset, Token *tok, int sz) {
+    // 末尾の NUL 文字は contents にないことがあるので、0 のままの側に含める
+    int len = tok->cont_len - 1 < sz ? tok->cont_len - 1 : sz;
+    if (offset == 0 && init->len == 0) {
+        // 変数の先頭から始まる文字列は、トークンの中身をコピーせずにそのまま指す
+        init->data = tok->contents;
+        init->len = len;
+        return;
     }
+    memcpy(init_bytes(init, offset, len), tok->contents, len);
+}
 
-    return cur;
+// 初期値の offset バイト目に、他のグローバル変数 var のアドレスを書き込むリロケーション
+Reloc *new_reloc(Reloc *cur, int offset, Var *var) {
+    Reloc *rel = arena_alloc(ARENA_AST, sizeof(Reloc));
+    rel->offset = offset;
+    rel->var = var;
+    cur->next = rel;
+    return rel;
 }
 
 // グローバル変数の初期化子
-Initializer *gvar_initializer(Initializer *cur, Type *ty) {
+// 型 ty の値を初期値の offset バイト目に書き込み、最後に追加したリロケーションを返す
+// 初期化されなかったメンバや配列の要素、構造体のパディングは 0 のまま残る
+Reloc *gvar_initializer(Initializer *init, Reloc *cur, Type *ty, int offset) {
     Token *tok = token;
 
+    // char の配列は文字列リテラルで初期化できる
+    if (ty->kind == TY_ARRAY && ty->base->kind == TY_CHAR && tok->kind == TK_STR) {
+        token = next_token(token);
+        if (ty->is_incomplete) {
+            complete_array(ty, tok->cont_len, tok);
+        }
+        init_string(init, offset, tok, ty->array_size);
+        return cur;
+    }
+
     // 初期化に使う値がカッコで始まる場合は配列か構造体
-    if (consume("{")) {
+    if (consume(PT_LBRACE)) {
         if (ty->kind == TY_ARRAY) {
+            int sz = size_of(ty->base, tok);
             int i = 0;
 
             // 再帰して配列の中身の初期化子を作る
             do {
-                cur = gvar_initializer(cur, ty->base);
+                cur = gvar_initializer(init, cur, ty->base, offset + sz * i);
                 i++;
-            } while (!peek_end() && consume(","));
+            } while (!peek_end() && consume(PT_COMMA));
 
             expect_end();
 
-            if (i < ty->array_size) {
-                // 初期化するデータが足りない場合は 0 埋めする
-                cur = new_init_zero(cur, size_of(ty->base, tok) * (ty->array_size - i));
-            }
-
             // 配列のサイズが指定されていない場合は補う
             if (ty->is_incomplete) {
-                ty->array_size = i;
-                ty->is_incomplete = false;
+                complete_array(ty, i, tok);
             }
 
             return cur;
@@ -840,22 +1112,11 @@ Initializer *gvar_initializer(Initializer *cur, Type *ty) {
 
             do {
                 // 再帰して構造体の各メンバの初期化子を作る
-                cur = gvar_initializer(cur, mem->ty);
-                // 必要ならパディング分の初期化子を追加する
-                cur = emit_struct_padding(cur, ty, mem);
+                cur = gvar_initializer(init, cur, mem->ty, offset + mem->offset);
                 mem = mem->next;
-            } while (!peek_end() && consume(","));
+            } while (!peek_end() && consume(PT_COMMA));
 
             expect_end();
-
-            if (mem) {
-                // まだ初期化されていないメンバが残っている場合は 0 埋めする
-                int sz = size_of(ty, tok) - mem->offset;
-                if (sz) {
-                    cur = new_init_zero(cur, sz);
-                }
-            }
-
             return cur;
         }
     }
@@ -865,41 +1126,53 @@ Initializer *gvar_initializer(Initializer *cur, Type *ty) {
     // グローバル変数の初期化に使えるのは…
     // 他のグローバル変数のポインタか
     if (expr->kind == ND_ADDR) {
-        if (expr->lhs->kind != ND_VAR) {
+        if (node_at(expr->lhs)->kind != ND_VAR) {
             error_tok(tok, "invalid initializer");
         }
-        return new_init_label(cur, expr->lhs->var->name);
+        return new_reloc(cur, offset, node_at(expr->lhs)->var);
     }
 
     // 配列型の変数(実質ポインタ)か
     if (expr->kind == ND_VAR && expr->var->ty->kind == TY_ARRAY) {
-        return new_init_label(cur, expr->var->name);
+        return new_reloc(cur, offset, expr->var);
     }
 
     // 定数式である
-    return new_init_val(cur, size_of(ty, token), eval(expr));
+    init_val(init, offset, size_of(ty, token), eval(expr));
+    return cur;
 }
 
 // global-var = type-specifier declarator type-suffix ("=" gvar-initializer)? ";"
-void global_var() {
-    Type *ty = type_specifier();
-    Token *tok = token;
-    char *name = NULL;
-    ty = declarator(ty, &name);
+// type-specifier declarator までは program で読み終えており、その結果を引数で受け取る
+void global_var(Type *ty, char *name, Token *tok) {
     ty = type_suffix(ty);
 
     Var *var = push_var(name, ty, false, tok);
     push_scope(name)->var = var;
 
-    if (consume("=")) {
+    if (consume(PT_ASSIGN)) {
         // グローバル変数に初期化子がついている場合
-        Initializer head;
-        head.next = NULL;
-        gvar_initializer(&head, ty);
-        var->initializer = head.next;
+        Initializer *init = arena_alloc(ARENA_AST, sizeof(Initializer));
+        Reloc head = {};
+        gvar_initializer(init, &head, ty, 0);
+        init->rels = head.next;
+
+        // 大きさの決まっていなかった配列は、初期化子を読み終えた時点で大きさが決まる
+        // 要素が多すぎた場合、変数に収まらない部分は捨てる
+        init->size = size_of(ty, tok);
+        if (init->len > init->size) {
+            init->len = init->size;
+        }
+        for (Reloc *rel = &head; rel->next; rel = rel->next) {
+            if (rel->next->offset + 8 > init->size) {
+                rel->next = NULL;
+                break;
+            }
+        }
+        var->initializer = init;
     }
 
-    expect(";");
+    expect(PT_SEMICOLON);
 }
 
 typedef struct Designator Designator;
@@ -955,8 +1228,8 @@ Node *lvar_init_zero(Node *cur, Var *var, Type *ty, Designator *desg) {
     }
 
     // 通常の要素であれば new_desg_node を使って 0 埋めする
-    cur->next = new_desg_node(var, desg, new_num(0, token));
-    return cur->next;
+    cur->next = node_id(new_desg_node(var, desg, new_num(0, token)));
+    return node_at(cur->next);
 }
 
 // ローカル変数への初期化リスト
@@ -986,12 +1259,11 @@ Node *lvar_initializer(Node *cur, Var *var, Type *ty, Designator *desg) {
     if (ty->kind == TY_ARRAY && ty->base->kind == TY_CHAR && token->kind == TK_STR) {
         // 文字列リテラルによる初期化
         Token *tok = token;
-        token = token->next;
+        token = next_token(token);
 
         if (ty->is_incomplete) {
             // incomplete だったら初期化リストの長さを配列の長さにする
-            ty->array_size = tok->cont_len;
-            ty->is_incomplete = false;
+            complete_array(ty, tok->cont_len, tok);
         }
 
         // 配列のサイズと初期化する文字列のサイズで、小さいほうにそろえる
@@ -1001,9 +1273,10 @@ Node *lvar_initializer(Node *cur, Var *var, Type *ty, Designator *desg) {
         // トークン内の文字列を一文字ずつにわけて通常通り初期化する
         for (i = 0; i < len; i++) {
             Designator desg2 = {desg, i, NULL};
-            Node *rhs = new_num(tok->contents[i], tok);
-            cur->next = new_desg_node(var, &desg2, rhs);
-            cur = cur->next;
+            // 最後の NUL 文字は contents にないことがある
+            Node *rhs = new_num(i < tok->cont_len - 1 ? tok->contents[i] : 0, tok);
+            cur->next = node_id(new_desg_node(var, &desg2, rhs));
+            cur = node_at(cur->next);
         }
 
         // 配列の残りの部分がある場合は 0 で初期化する
@@ -1016,7 +1289,7 @@ Node *lvar_initializer(Node *cur, Var *var, Type *ty, Designator *desg) {
     }
 
     // 通常の初期化リストによる初期化
-    Token *tok = consume("{");
+    Token *tok = consume(PT_LBRACE);
     if (!tok) {
         // 配列や構造体の初期化ではなく、単一の変数の初期化の場合
         // desg には親要素の情報が入っている
@@ -1025,8 +1298,8 @@ Node *lvar_initializer(Node *cur, Var *var, Type *ty, Designator *desg) {
         // みたいな初期化を可能にするため
         // assign で int x[3] = {1,2,3} の全体の代入文をパースしているわけではない
         // 上記の式の場合、assign() を呼ぶと初回は 1 だけをパースする
-        cur->next = new_desg_node(var, desg, assign());
-        return cur->next;
+        cur->next = node_id(new_desg_node(var, desg, assign()));
+        return node_at(cur->next);
     }
 
     if (ty->kind == TY_ARRAY) {
@@ -1041,7 +1314,7 @@ Node *lvar_initializer(Node *cur, Var *var, Type *ty, Designator *desg) {
             // lvar_initializer は新たに作ったノードを返すので
             // cur に入れなおすことでリンクリストになる
             cur = lvar_initializer(cur, var, ty->base, &desg2);
-        } while(!peek_end() && consume(","));
+        } while(!peek_end() && consume(PT_COMMA));
 
         expect_end();
 
@@ -1053,8 +1326,7 @@ Node *lvar_initializer(Node *cur, Var *var, Type *ty, Designator *desg) {
 
         if (ty->is_incomplete) {
             // incomplete な場合、初期化リストの長さを配列の長さにする
-            ty->array_size = i;
-            ty->is_incomplete = false;
+            complete_array(ty, i, tok);
         }
 
         return cur;
@@ -1068,7 +1340,7 @@ Node *lvar_initializer(Node *cur, Var *var, Type *ty, Designator *desg) {
             // メンバ1つを初期化するコードを生成
             cur = lvar_initializer(cur, var, mem->ty, &desg2);
             mem = mem->next;
-        } while (!peek_end() && consume(","));
+        } while (!peek_end() && consume(PT_COMMA));
 
         expect_end();
 
@@ -1088,11 +1360,12 @@ Node *lvar_initializer(Node *cur, Var *var, Type *ty, Designator *desg) {
 //             | type-specifier ";"
 Node *declaration() {
     Token *tok;
-    Type *ty = type_specifier();
+    VarAttr attr;
+    Type *ty = type_specifier(&attr);
 
     // 型の定義だけあり変数がない場合は、構造体/列挙型のタグ登録だけを意図している
     // type_specifier によるパースで型が登録され目的を達成しているので NULL ノードにする
-    if (tok = consume(";")) {
+    if (tok = consume(PT_SEMICOLON)) {
         return new_node(ND_NULL, tok);
     }
 
@@ -1101,12 +1374,11 @@ Node *declaration() {
     ty = declarator(ty, &name);
     ty = type_suffix(ty);
 
-    if (ty->is_typedef) {
+    if (attr.is_typedef) {
         // type-specifier のパースの結果、typedef であった場合
         // typedef でいきなり変数宣言はできないので ";" がこないといけない
         // typedef int Integer x; は無理
-        expect(";");
-        ty->is_typedef = false;
+        expect(PT_SEMICOLON);
         push_scope(name)->type_def = ty;
         return new_node(ND_NULL, tok);
     }
@@ -1118,7 +1390,7 @@ Node *declaration() {
     }
 
     Var *var;
-    if (ty->is_static) {
+    if (attr.is_static) {
         // ブロック内で static 変数が宣言される場合
         // ブロック内の static 変数とは、スコープがブロック内だけど関数を抜けても解放されない
         // すなわちグローバル変数と同じ位置に領域を確保する必要がある
@@ -1133,19 +1405,19 @@ Node *declaration() {
     push_scope(name)->var = var;
 
     // 初期値のない変数宣言はからっぽの文になる
-    if (consume(";")) {
+    if (consume(PT_SEMICOLON)) {
         return new_node(ND_NULL, tok);
     }
 
     // 初期値がある場合は代入文になる
-    expect("=");
+    expect(PT_ASSIGN);
 
     Node head;
-    head.next = NULL;
+    head.next = 0;
     // head は初期化値のリスト、var は初期化される変数
     // 初期化のためのノードの配列で head が更新される
     lvar_initializer(&head, var, var->ty, NULL);
-    expect(";");
+    expect(PT_SEMICOLON);
 
     // 配列を初期化する場合、代入文が複数生成される可能性があるのでブロックにする
     Node *node = new_node(ND_BLOCK, tok);
@@ -1154,10 +1426,21 @@ Node *declaration() {
 }
 
 bool is_typename() {
-    return peek("void") || peek("_Bool") ||
-           peek("char") || peek("short") || peek("int") || peek("long") ||
-           peek("enum") || peek("struct") || peek("typedef") || peek("static") ||
-           find_typedef(token);
+    switch (token->reserved) {
+    case KW_VOID:
+    case KW_BOOL:
+    case KW_CHAR:
+    case KW_SHORT:
+    case KW_INT:
+    case KW_LONG:
+    case KW_ENUM:
+    case KW_STRUCT:
+    case KW_TYPEDEF:
+    case KW_STATIC:
+        return true;
+    default:
+        return find_typedef(token);
+    }
 }
 
 Node *read_expr_stmt() {
@@ -1183,31 +1466,31 @@ Node *stmt() {
     Token *tok;
 
     // return 文
-    if (tok = consume("return")) {
+    if (tok = consume(KW_RETURN)) {
         Node *node = new_unary(ND_RETURN, expr(), tok);
-        expect(";");
+        expect(PT_SEMICOLON);
         return node;
     }
 
     // if 文
-    if (tok = consume("if")) {
+    if (tok = consume(KW_IF)) {
         Node *node = new_node(ND_IF, tok);
-        expect("(");
-        node->cond = expr();
-        expect(")");
-        node->then = stmt();
-        if (consume("else")) {
-            node->els = stmt();
+        expect(PT_LPAREN);
+        node->cond = node_id(expr());
+        expect(PT_RPAREN);
+        node->then = node_id(stmt());
+        if (consume(KW_ELSE)) {
+            node->els = node_id(stmt());
         }
         return node;
     }
 
     // switch 文
-    if (tok = consume("switch")) {
+    if (tok = consume(KW_SWITCH)) {
         Node *node = new_node(ND_SWITCH, tok);
-        expect("(");
-        node->cond = expr();
-        expect(")");
+        expect(PT_LPAREN);
+        node->cond = node_id(expr());
+        expect(PT_RPAREN);
 
         // switch 文がネストする場合に備え、今の switch 文のノードを控えておく
         Node *sw = current_switch;
@@ -1216,90 +1499,90 @@ Node *stmt() {
         //   e.g., case 1: x += 1; y += 1; break;
         //   とすると、 y += 1 は実行されない
         current_switch = node;
-        node->then = stmt();
+        node->then = node_id(stmt());
         // switch 文のパースを終えたら戻す
         current_switch = sw;
         return node;
     }
 
-    if (tok = consume("case")) {
+    if (tok = consume(KW_CASE)) {
         if (!current_switch) {
             // switch 文でないところで case がでてきたらエラー
             error_tok(tok, "stray case");
         }
         // case 文に書けるのは数字のみ (式や変数はダメ)
         int val = const_expr();
-        expect(":");
+        expect(PT_COLON);
 
         // case に対応する文をパース
         Node *node = new_unary(ND_CASE, stmt(), tok);
-        // case の条件部に使う数値は val に入れる
-        node->val = val;
+        // case の条件部に使う数値は case_val に入れる
+        node->case_val = val;
         // switch 文では複数の case 文が並ぶことになるので、リストで表現
-        // current_switch->case_next には直前にパースした case 文のノードが入っている
+        // current_switch->cases には直前にパースした case 文のノードが入っている
         // todo: このつなぎ方だと、後ろの case 文のほうが先頭にくる
         //       C の規格だと同じ値を持った case 文は文法エラーなので問題ない
         //       ただ現状は同じ値があってもエラーにならない
-        node->case_next = current_switch->case_next;
-        current_switch->case_next = node;
+        node->case_next = current_switch->cases;
+        current_switch->cases = node_id(node);
         return node;
     }
 
-    if (tok = consume("default")) {
+    if (tok = consume(KW_DEFAULT)) {
         if (!current_switch) {
             error_tok(tok, "stray default");
         }
-        expect(":");
+        expect(PT_COLON);
 
         Node *node = new_unary(ND_CASE, stmt(), tok);
         // current_switch は今の switch 文のノードを指している
         // コード生成時に使えるように、パース中の switch 文の default_case に
         // default 文のノードへのポインタを保存する
-        current_switch->default_case = node;
+        current_switch->default_case = node_id(node);
         return node;
     }
 
     // while 文
-    if (tok = consume("while")) {
+    if (tok = consume(KW_WHILE)) {
         Node *node = new_node(ND_WHILE, tok);
-        expect("(");
-        node->cond = expr();
-        expect(")");
-        node->then = stmt();
+        expect(PT_LPAREN);
+        node->cond = node_id(expr());
+        expect(PT_RPAREN);
+        node->then = node_id(stmt());
         return node;
     }
 
     // for 文
-    if (tok = consume("for")) {
+    if (tok = consume(KW_FOR)) {
         Node *node = new_node(ND_FOR, tok);
-        expect("(");
-        Scope *sc = enter_scope();
+        expect(PT_LPAREN);
+        Scope sc = enter_scope();
 
         // 初期化部がからっぽの場合はなにも出力しない
-        if (!consume(";")) {
+        if (!consume(PT_SEMICOLON)) {
             if (is_typename()) {
                 // 変数宣言が始まった場合
                 // declaration には末尾の ";" のパースまで含まれている
-                node->init = declaration();
+                node->init = node_id(declaration());
             }
             else {
                 // ただの代入文の場合
                 // 初期化部の評価結果は捨てる
-                node->init = read_expr_stmt();
-                expect(";");
+                node->init = node_id(read_expr_stmt());
+                expect(PT_SEMICOLON);
             }
         }
-        if (!consume(";")) {
+        if (!consume(PT_SEMICOLON)) {
             // 条件部の結果はスタックトップに残す必要がある
-            node->cond = expr();
-            expect(";");
+            node->cond = node_id(expr());
+            expect(PT_SEMICOLON);
         }
-        if (!consume(")")) {
+        if (!consume(PT_RPAREN)) {
             // インクリメント部の評価結果は捨てる
-            node->inc = read_expr_stmt();
-            expect(")");
+            node->inc = node_id(read_expr_stmt());
+            expect(PT_RPAREN);
         }
-        node->then = stmt();
+        node->then = node_id(stmt());
 
         // for 文を抜けたあとはスコープを元に戻す
         leave_scope(sc);
@@ -1307,19 +1590,19 @@ Node *stmt() {
     }
 
     // ブロック
-    if (tok = consume("{")) {
+    if (tok = consume(PT_LBRACE)) {
         Node head;
-        head.next = NULL;
+        head.next = 0;
         Node *cur = &head;
 
         // ブロックの中だけで有効な変数が定義されるかもしれないので
         // 今の scope を控えておく
         // ブロック内をパースしている間は一時的にリストが伸びることになる
-        Scope *sc = enter_scope();
+        Scope sc = enter_scope();
         // 中身の複数文を順番にリストに入れていく
-        while (!consume("}")) {
-            cur->next = stmt();
-            cur = cur->next;
+        while (!consume(PT_RBRACE)) {
+            cur->next = node_id(stmt());
+            cur = node_at(cur->next);
         }
         // ブロック内で定義されていた変数を忘れるため、scope を戻す
         leave_scope(sc);
@@ -1329,34 +1612,32 @@ Node *stmt() {
         return node;
     }
 
-    if (tok = consume("break")) {
-        expect(";");
+    if (tok = consume(KW_BREAK)) {
+        expect(PT_SEMICOLON);
         return new_node(ND_BREAK, tok);
     }
 
-    if (tok = consume("continue")) {
-        expect(";");
+    if (tok = consume(KW_CONTINUE)) {
+        expect(PT_SEMICOLON);
         return new_node(ND_CONTINUE, tok);
     }
 
-    if (tok = consume("goto")) {
+    if (tok = consume(KW_GOTO)) {
         Node *node = new_node(ND_GOTO, tok);
         node->label_name = expect_ident();
-        expect(";");
+        expect(PT_SEMICOLON);
         return node;
     }
 
-    if (tok = consume_ident()) {
-        if (consume(":")) {
-            Node *node = new_unary(ND_LABEL, stmt(), tok);
-            node->label_name = strndup(tok->str, tok->len);
-            return node;
-        }
-        // 識別子のあとに ":" がなかった場合(ラベルでなかった場合)は読んでしまったトークンを戻す
-        // 戻さないと、識別子で始まる式がパースできなくなる
-        // e.g., x = x + 1;
-        // 最初の x が consume_ident で消費されてしまう
-        token = tok;
+    // 識別子のあとに ":" が続く場合はラベル
+    // トークンを1つ先読みするだけで判定できるので、読み進める必要はない
+    // e.g., x = x + 1; は識別子で始まるが ":" が続かないのでラベルではない
+    if (token->kind == TK_IDENT && next_token(token)->reserved == PT_COLON) {
+        tok = consume_ident();
+        expect(PT_COLON);
+        Node *node = new_unary(ND_LABEL, stmt(), tok);
+        node->label_name = tok->name;
+        return node;
     }
 
     if (is_typename()) {
@@ -1366,7 +1647,7 @@ Node *stmt() {
     // 式のみからなる文
     Node *node = read_expr_stmt();
 
-    expect(";");
+    expect(PT_SEMICOLON);
     return node;
 }
 
@@ -1374,7 +1655,7 @@ Node *stmt() {
 Node *expr() {
     Node *node = assign();
     Token *tok;
-    while (tok = consume(",")) {
+    while (tok = consume(PT_COMMA)) {
         node = new_unary(ND_EXPR_STMT, node, node->tok);
         node = new_binary(ND_COMMA, node, assign(), tok); 
     }
@@ -1385,44 +1666,44 @@ long eval(Node *node) {
     // 定数式はコンパイル時に評価(eval)してしまう
     switch(node->kind) {
     case ND_ADD:
-        return eval(node->lhs) + eval(node->rhs);
+        return eval(node_at(node->lhs)) + eval(node_at(node->rhs));
     case ND_SUB:
-        return eval(node->lhs) - eval(node->rhs);
+        return eval(node_at(node->lhs)) - eval(node_at(node->rhs));
     case ND_MUL:
-        return eval(node->lhs) * eval(node->rhs);
+        return eval(node_at(node->lhs)) * eval(node_at(node->rhs));
     case ND_DIV:
-        return eval(node->lhs) / eval(node->rhs);
+        return eval(node_at(node->lhs)) / eval(node_at(node->rhs));
     case ND_BITAND:
-        return eval(node->lhs) & eval(node->rhs);
+        return eval(node_at(node->lhs)) & eval(node_at(node->rhs));
     case ND_BITOR:
-        return eval(node->lhs) | eval(node->rhs);
+        return eval(node_at(node->lhs)) | eval(node_at(node->rhs));
     case ND_BITXOR:
-        return eval(node->lhs) ^ eval(node->rhs);
+        return eval(node_at(node->lhs)) ^ eval(node_at(node->rhs));
     case ND_SHL:
-        return eval(node->lhs) << eval(node->rhs);
+        return eval(node_at(node->lhs)) << eval(node_at(node->rhs));
     case ND_SHR:
-        return eval(node->lhs) >> eval(node->rhs);
+        return eval(node_at(node->lhs)) >> eval(node_at(node->rhs));
     case ND_EQ:
-        return eval(node->lhs) == eval(node->rhs);
+        return eval(node_at(node->lhs)) == eval(node_at(node->rhs));
     case ND_NE:
-        return eval(node->lhs) != eval(node->rhs);
+        return eval(node_at(node->lhs)) != eval(node_at(node->rhs));
     case ND_LT:
-        return eval(node->lhs) < eval(node->rhs);
+        return eval(node_at(node->lhs)) < eval(node_at(node->rhs));
     case ND_LE:
-        return eval(node->lhs) <= eval(node->rhs);
+        return eval(node_at(node->lhs)) <= eval(node_at(node->rhs));
     case ND_TERNARY:
-        return eval(node->cond) ? eval(node->then) : eval(node->els);
+        return eval(node_at(node->cond)) ? eval(node_at(node->then)) : eval(node_at(node->els));
     case ND_COMMA:
         // 左辺は const 式なので副作用がない、つまり評価する必要がない
-        return eval(node->rhs);
+        return eval(node_at(node->rhs));
     case ND_NOT:
-        return !eval(node->lhs);
+        return !eval(node_at(node->lhs));
     case ND_BITNOT:
-        return ~eval(node->lhs);
+        return ~eval(node_at(node->lhs));
     case ND_LOGAND:
-        return eval(node->lhs) && eval(node->rhs);
+        return eval(node_at(node->lhs)) && eval(node_at(node->rhs));
     case ND_LOGOR:
-        return eval(node->lhs) || eval(node->rhs);
+        return eval(node_at(node->lhs)) || eval(node_at(node->rhs));
     case ND_NUM:
         return node->val;
     }
@@ -1438,46 +1719,52 @@ long const_expr() {
 // assign-op = "=" | "+=" | "-=" | "*=" | "/="
 Node *assign() {
     Node *node = conditional();
-    Token *tok;
+    Token *tok = token;
+    NodeKind kind;
 
-    if (tok = consume("=")) {
-        node = new_binary(ND_ASSIGN, node, assign(), tok);
-    }
-    if (tok = consume("+=")) {
-        node = new_binary(ND_A_ADD, node, assign(), tok);
-    }
-    if (tok = consume("-=")) {
-        node = new_binary(ND_A_SUB, node, assign(), tok);
-    }
-    if (tok = consume("*=")) {
-        node = new_binary(ND_A_MUL, node, assign(), tok);
-    }
-    if (tok = consume("/=")) {
-        node = new_binary(ND_A_DIV, node, assign(), tok);
-    }
-    if (tok = consume("<<=")) {
-        node = new_binary(ND_A_SHL, node, assign(), tok);
-    }
-    if (tok = consume(">>=")) {
-        node = new_binary(ND_A_SHR, node, assign(), tok);
+    switch (tok->reserved) {
+    case PT_ASSIGN:
+        kind = ND_ASSIGN;
+        break;
+    case PT_ADD_ASSIGN:
+        kind = ND_A_ADD;
+        break;
+    case PT_SUB_ASSIGN:
+        kind = ND_A_SUB;
+        break;
+    case PT_MUL_ASSIGN:
+        kind = ND_A_MUL;
+        break;
+    case PT_DIV_ASSIGN:
+        kind = ND_A_DIV;
+        break;
+    case PT_SHL_ASSIGN:
+        kind = ND_A_SHL;
+        break;
+    case PT_SHR_ASSIGN:
+        kind = ND_A_SHR;
+        break;
+    default:
+        return node;
     }
 
-    return node;
+    token = next_token(token);
+    return new_binary(kind, node, assign(), tok);
 }
 
 // conditional = logor ("?" expr ":" conditional)?
 Node *conditional() {
     Node *node = logor();
-    Token *tok = consume("?");
+    Token *tok = consume(PT_QUESTION);
     if (!tok) {
         return node;
     }
 
     Node *ternary = new_node(ND_TERNARY, tok);
-    ternary->cond = node;
-    ternary->then = expr();
-    expect(":");
-    ternary->els = conditional();
+    ternary->cond = node_id(node);
+    ternary->then = node_id(expr());
+    expect(PT_COLON);
+    ternary->els = node_id(conditional());
     return ternary;
 }
 
@@ -1485,7 +1772,7 @@ Node *conditional() {
 Node *logor() {
     Node *node = logand();
     Token *tok;
-    while (tok = consume("||")) {
+    while (tok = consume(PT_LOGOR)) {
         node = new_binary(ND_LOGOR, node, logand(), tok);
     }
     return node;
@@ -1495,7 +1782,7 @@ Node *logor() {
 Node *logand() {
     Node *node = bitor();
     Token *tok;
-    while (tok = consume("&&")) {
+    while (tok = consume(PT_LOGAND)) {
         node = new_binary(ND_LOGAND, node, bitor(), tok);
     }
     return node;
@@ -1505,7 +1792,7 @@ Node *logand() {
 Node *bitor() {
     Node *node = bitxor();
     Token *tok;
-    while (tok = consume("|")) {
+    while (tok = consume(PT_PIPE)) {
         node = new_binary(ND_BITOR, node, bitxor(), tok);
     }
     return node;
@@ -1515,7 +1802,7 @@ Node *bitor() {
 Node *bitxor() {
     Node *node = bitand();
     Token *tok;
-    while (tok = consume("^")) {
+    while (tok = consume(PT_CARET)) {
         node = new_binary(ND_BITXOR, node, bitand(), tok);
     }
     return node;
@@ -1525,7 +1812,7 @@ Node *bitxor() {
 Node *bitand() {
     Node *node = equality();
     Token *tok;
-    while (tok = consume("&")) {
+    while (tok = consume(PT_AMP)) {
         node = new_binary(ND_BITAND, node, equality(), tok);
     }
     return node;
@@ -1537,10 +1824,10 @@ Node *equality() {
     Token *tok;
 
     for (;;) {
-        if (tok = consume("==")) {
+        if (tok = consume(PT_EQ)) {
             node = new_binary(ND_EQ, node, relational(), tok);
         }
-        else if (consume("!=")) {
+        else if (tok = consume(PT_NE)) {
             node = new_binary(ND_NE, node, relational(), tok);
         }
         else {
@@ -1555,16 +1842,16 @@ Node *relational() {
     Token *tok;
 
     for (;;) {
-        if (tok = consume("<")) {
+        if (tok = consume(PT_LT)) {
             node = new_binary(ND_LT, node, shift(), tok);
         }
-        else if (tok = consume("<=")) {
+        else if (tok = consume(PT_LE)) {
             node = new_binary(ND_LE, node, shift(), tok);
         }
-        else if (tok = consume(">")) {
+        else if (tok = consume(PT_GT)) {
             node = new_binary(ND_LT, shift(), node, tok);
         }
-        else if (tok = consume(">=")) {
+        else if (tok = consume(PT_GE)) {
             node = new_binary(ND_LE, shift(), node, tok);
         }
         else {
@@ -1579,10 +1866,10 @@ Node *shift() {
     Token *tok;
 
     for (;;) {
-        if (tok = consume("<<")) {
+        if (tok = consume(PT_SHL)) {
             node = new_binary(ND_SHL, node, add(), tok);
         }
-        else if (tok = consume(">>")) {
+        else if (tok = consume(PT_SHR)) {
             node = new_binary(ND_SHR, node, add(), tok);
         }
         else {
@@ -1597,10 +1884,10 @@ Node *add() {
     Token *tok;
 
     for (;;) {
-        if (tok = consume("+")) {
+        if (tok = consume(PT_PLUS)) {
             node = new_binary(ND_ADD, node, mul(), tok);
         }
-        else if (tok = consume("-")) {
+        else if (tok = consume(PT_MINUS)) {
             node = new_binary(ND_SUB, node, mul(), tok);
         }
         else {
@@ -1615,10 +1902,10 @@ Node *mul() {
     Token *tok;
 
     for (;;) {
-        if (tok = consume("*")) {
+        if (tok = consume(PT_STAR)) {
             node = new_binary(ND_MUL, node, cast(), tok);
         }
-        else if (tok = consume("/")) {
+        else if (tok = consume(PT_SLASH)) {
             node = new_binary(ND_DIV, node, cast(), tok);
         }
         else {
@@ -1629,20 +1916,22 @@ Node *mul() {
 
 // cast = "(" type-name ")" cast | unary
 Node *cast() {
-    Token *tok = token;
+    Token *tok = mark_token();
 
-    if (consume("(")) {
+    if (consume(PT_LPAREN)) {
         if (is_typename()) {
+            drop_mark();
             Type *ty = type_name();
-            expect(")");
+            expect(PT_RPAREN);
             Node *node = new_unary(ND_CAST, cast(), tok);
             node->ty = ty;
             return node;
         }
-        // キャストでなかったら戻す
-        token = tok;
     }
 
+    // キャストでなかったら戻す
+    rewind_token(tok);
+
     return unary();
 }
 
@@ -1652,30 +1941,30 @@ Node *cast() {
 Node *unary() {
     Token *tok;
 
-    if (consume("+")) {
+    if (consume(PT_PLUS)) {
         return cast();
     }
-    if (tok = consume("-")) {
+    if (tok = consume(PT_MINUS)) {
         return new_binary(ND_SUB, new_num(0, tok), cast(), tok);
     }
-    if (tok = consume("&")) {
+    if (tok = consume(PT_AMP)) {
         return new_unary(ND_ADDR, cast(), tok);
     }
-    if (tok = consume("*")) {
+    if (tok = consume(PT_STAR)) {
         return new_unary(ND_DEREF, cast(), tok);
     }
-    if (tok = consume("!")) {
+    if (tok = consume(PT_NOT)) {
         return new_unary(ND_NOT, cast(), tok);
     }
-    if (tok = consume("~")) {
+    if (tok = consume(PT_TILDE)) {
         return new_unary(ND_BITNOT, cast(), tok);
     }
-    if (tok = consume("++")) {
+    if (tok = consume(PT_INC)) {
         // "+" か "++" かはトークナイズのときに確定しているので、
         // パースのときには "+" と "++" の順番を気にする必要はない 
         return new_unary(ND_PRE_INC, unary(), tok);
     }
-    if (tok = consume("--")) {
+    if (tok = consume(PT_DEC)) {
         return new_unary(ND_PRE_DEC, unary(), tok);
     }
     return postfix();
@@ -1687,16 +1976,16 @@ Node *postfix() {
     Token *tok;
 
     for (;;) {
-        if (tok = consume("[")) {
+        if (tok = consume(PT_LBRACKET)) {
             // x[y] は *(x+y) と同じ
             Node *exp = new_binary(ND_ADD, node, expr(), tok);
-            expect("]");
+            expect(PT_RBRACKET);
             node = new_unary(ND_DEREF, exp, tok);
             continue;
         }
 
         // 構造体のメンバアクセス時は member_name にメンバ名を入れる
-        if (tok = consume(".")) {
+        if (tok = consume(PT_DOT)) {
             node = new_unary(ND_MEMBER, node, tok);
             node->member_name = expect_ident();
             continue;
@@ -1704,19 +1993,19 @@ Node *postfix() {
 
         // アロー演算子は、ポインタを deref した上でメンバアクセスする
         // e.g., pos->x == (*pos).x
-        if (tok = consume("->")) {
+        if (tok = consume(PT_ARROW)) {
             node = new_unary(ND_DEREF, node, tok);
             node = new_unary(ND_MEMBER, node, tok);
             node->member_name = expect_ident();
             continue;
         }
 
-        if (tok = consume("++")) {
+        if (tok = consume(PT_INC)) {
             node = new_unary(ND_POST_INC, node, tok);
             continue;
         }
 
-        if (tok = consume("--")) {
+        if (tok = consume(PT_DEC)) {
             node = new_unary(ND_POST_DEC, node, tok);
             continue;
         }
@@ -1727,19 +2016,22 @@ Node *postfix() {
 
 // stmt-expr = stmt* "}" ")"
 Node *stmt_expr(Token *tok) {
-    Scope *sc = enter_scope();
+    Scope sc = enter_scope();
 
     Node *node = new_node(ND_STMT_EXPR, tok);
-    node->body = stmt();
-    Node *cur = node->body;
+    Node head = {};
+    Node *prev = &head;
+    Node *cur = stmt();
+    prev->next = node_id(cur);
 
     // primary のほうで "(" "{" はパースしているので、stmt のパースから始めればいい
     // 複数の statement をパースして body につなげていく
-    while (!consume("}")) {
-        cur->next = stmt();
-        cur = cur->next;
+    while (!consume(PT_RBRACE)) {
+        prev = cur;
+        cur = stmt();
+        prev->next = node_id(cur);
     }
-    expect(")");
+    expect(PT_RPAREN);
 
     leave_scope(sc);
 
@@ -1748,8 +2040,9 @@ Node *stmt_expr(Token *tok) {
         error_tok(cur->tok, "statement expression returning void is not supported");
     }
     // 最後の文の中身の式を取り出して持ち上げる
-    // 構造体の代入なので値がすべてコピーされる
-    *cur = *cur->lhs;
+    // ノードは種類ごとに大きさが違うので、中身を写さずに式文と式をつなぎ替える
+    prev->next = cur->lhs;
+    node->body = head.next;
     return node;
 }
 
@@ -1757,17 +2050,17 @@ Node *stmt_expr(Token *tok) {
 Node *func_args() {
     // ただの変数か関数呼び出しかを判断するため、既に "(" は消費されている
     // すぐに ")" がきたら引数なしの関数呼び出し
-    if (consume(")")) {
+    if (consume(PT_RPAREN)) {
         return NULL;
     }
 
     Node *head = assign();
     Node *cur = head;
-    while (consume(",")) {
-        cur->next = assign();
-        cur = cur->next;
+    while (consume(PT_COMMA)) {
+        cur->next = node_id(assign());
+        cur = node_at(cur->next);
     }
-    expect(")");
+    expect(PT_RPAREN);
     return head;
 }
 
@@ -1782,39 +2075,38 @@ Node *func_args() {
 Node *primary() {
     Token *tok;
 
-    if (tok = consume("(")) {
-        if (consume("{")) {
+    if (tok = consume(PT_LPAREN)) {
+        if (consume(PT_LBRACE)) {
             return stmt_expr(tok);
         }
 
         Node *node = expr();
-        expect(")");
+        expect(PT_RPAREN);
         return node;
     }
 
-    if (tok = consume("sizeof")) {
+    if (tok = consume(KW_SIZEOF)) {
         // 型名への sizeof には括弧が必須
-        if (consume("(")) {
-            if (is_typename()) {
-                Type *ty = type_name();
-                expect(")");
-                return new_num(size_of(ty, tok), tok);
-            }
-            // この時点で tok は sizeof を指しているの
-            // next は開き括弧から始まる unary と思われるトークンを指す
-            token = tok->next;
+        Token *mark = mark_token();
+        if (consume(PT_LPAREN) && is_typename()) {
+            drop_mark();
+            Type *ty = type_name();
+            expect(PT_RPAREN);
+            return new_num(size_of(ty, tok), tok);
         }
+        // 型名でなかった場合は開き括弧から始まる unary として読み直す
+        rewind_token(mark);
         // 型名への sizeof には括弧が必須なので、括弧がない場合は unary
         return new_unary(ND_SIZEOF, unary(), tok);
     }
 
     if (tok = consume_ident()) {
-        if (consume("(")) {
+        if (consume(PT_LPAREN)) {
             // 関数呼び出しである場合は関数名を控える
             Node *node = new_node(ND_FUNCALL, tok);
-            node->funcname = strndup(tok->str, tok->len);
+            node->funcname = tok->name;
             // 関数呼び出し時の引数をパース
-            node->args = func_args();
+            node->args = node_id(func_args());
 
             // 関数定義を探す
             VarScope *sc = find_var(tok);
@@ -1851,14 +2143,17 @@ Node *primary() {
     tok = token;
     if (tok->kind == TK_STR) {
         // expect などでトークンを消費できないので直接進める
-        token = token->next;
+        token = next_token(token);
 
         // 文字列は char の配列
         Type *ty = array_of(char_type(), tok->cont_len);
         // 変数ではなくラベルを登録する
         // ラベルはコード生成時にラベルとして使われる
         Var *var = push_var(new_label(), ty, false, NULL);
-        var->initializer = gvar_init_string(tok->contents, tok->cont_len);
+        var->is_literal = true;
+        var->initializer = arena_alloc(ARENA_AST, sizeof(Initializer));
+        var->initializer->size = tok->cont_len;
+        init_string(var->initializer, 0, tok, tok->cont_len);
         // 文字列リテラルは変数として扱う
         return new_var(var, tok);
     }
@@ -0,0 +1,281 @@
+#include <string.h>
+#include <stdint.h>
+#include "9cc.h"
+
+// 字句解析で文字の並びを読み飛ばす処理
+//
+// 空白、コメント、識別子、数字、文字列リテラルの中身は、同じ種類の文字が続く間読み進めるだけなので、
+// 16 バイト(SSE2)か 32 バイト(AVX2)ずつまとめて調べる
+// どの実装を使うかは起動時に CPU を調べて決め、x86-64 以外ではバイトごとに調べる
+//
+// どの関数も NUL で必ず止まるので、入力の終端を越えて読み進めることはない
+// ベクトルで読むときは読み込むアドレスをベクトルの大きさにそろえる
+// そろえた読み込みはページをまたがないので、終端の NUL を含むベクトルを読んでもフォールトしない
+// ただし、確保した領域の外を読むことはあるので、その関数だけ ASan の検査を外している
+
+#if defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define NO_ASAN __attribute__((no_sanitize_address))
+#endif
+#endif
+#if !defined(NO_ASAN) && defined(__SANITIZE_ADDRESS__)
+#define NO_ASAN __attribute__((no_sanitize_address))
+#endif
+#ifndef NO_ASAN
+#define NO_ASAN
+#endif
+
+// 読み飛ばす文字の種類
+typedef enum {
+    CLASS_SPACE,    // 空白以外の文字で止まる
+    CLASS_IDENT,    // 識別子に使えない文字で止まる
+    CLASS_DIGIT,    // 数字以外の文字で止まる
+    CLASS_LINE,     // '\n' か NUL で止まる
+    CLASS_STAR,     // '*' か NUL で止まる
+    CLASS_STRING,   // '"' か '\\' か NUL で止まる
+} CharClass;
+
+//
+// バイトごとに調べる実装
+//
+
+static bool is_stop_scalar(unsigned char c, CharClass cls) {
+    switch (cls) {
+    case CLASS_SPACE:
+        return !(c == ' ' || (c - '\t') < 5u);
+    case CLASS_IDENT:
+        return !(((c | 0x20) - 'a') < 26u || (c - '0') < 10u || c == '_');
+    case CLASS_DIGIT:
+        return !((c - '0') < 10u);
+    case CLASS_LINE:
+        return c == '\n' || c == '\0';
+    case CLASS_STAR:
+        return c == '*' || c == '\0';
+    default:
+        assert(cls == CLASS_STRING);
+        return c == '"' || c == '\\' || c == '\0';
+    }
+}
+
+#define SCALAR_SCAN(name, cls)                  \
+    static char *name##_scalar(char *p) {       \
+        while (!is_stop_scalar(*p, cls)) {      \
+            p++;                                \
+        }                                       \
+        return p;                               \
+    }
+
+SCALAR_SCAN(skip_space, CLASS_SPACE)
+SCALAR_SCAN(skip_ident, CLASS_IDENT)
+SCALAR_SCAN(skip_digits, CLASS_DIGIT)
+SCALAR_SCAN(find_newline, CLASS_LINE)
+SCALAR_SCAN(find_star, CLASS_STAR)
+SCALAR_SCAN(find_string_end, CLASS_STRING)
+
+#ifdef __x86_64__
+#include <immintrin.h>
+
+//
+// SSE2 の実装
+// SSE2 は x86-64 なら必ず使える
+//
+
+// 符号なしで lo <= x[i] && x[i] <= hi となるバイトを 0xff にする
+static inline __m128i in_range_sse2(__m128i x, char lo, char hi) {
+    __m128i t = _mm_sub_epi8(x, _mm_set1_epi8(lo));
+    return _mm_cmpeq_epi8(_mm_min_epu8(t, _mm_set1_epi8(hi - lo)), t);
+}
+
+static inline __m128i eq_sse2(__m128i x, char c) {
+    return _mm_cmpeq_epi8(x, _mm_set1_epi8(c));
+}
+
+// 止まるべきバイトのビットを立てたマスクを返す
+static inline unsigned stop_mask_sse2(__m128i x, CharClass cls) {
+    __m128i m;
+    switch (cls) {
+    case CLASS_SPACE:
+        m = _mm_or_si128(eq_sse2(x, ' '), in_range_sse2(x, '\t', '\r'));
+        return ~_mm_movemask_epi8(m) & 0xffff;
+    case CLASS_IDENT:
+        m = in_range_sse2(_mm_or_si128(x, _mm_set1_epi8(0x20)), 'a', 'z');
+        m = _mm_or_si128(m, in_range_sse2(x, '0', '9'));
+        m = _mm_or_si128(m, eq_sse2(x, '_'));
+        return ~_mm_movemask_epi8(m) & 0xffff;
+    case CLASS_DIGIT:
+        return ~_mm_movemask_epi8(in_range_sse2(x, '0', '9')) & 0xffff;
+    case CLASS_LINE:
+        m = _mm_or_si128(eq_sse2(x, '\n'), eq_sse2(x, '\0'));
+        return _mm_movemask_epi8(m);
+    case CLASS_STAR:
+        m = _mm_or_si128(eq_sse2(x, '*'), eq_sse2(x, '\0'));
+        return _mm_movemask_epi8(m);
+    default:
+        m = _mm_or_si128(eq_sse2(x, '"'), eq_sse2(x, '\\'));
+        m = _mm_or_si128(m, eq_sse2(x, '\0'));
+        return _mm_movemask_epi8(m);
+    }
+}
+
+// p を含む 16 バイト境界から読み、p より前のバイトはマスクから外す
+NO_ASAN static inline char *scan_sse2(char *p, CharClass cls) {
+    char *a = (char *)((uintptr_t)p & ~(uintptr_t)15);
+    unsigned mask = stop_mask_sse2(_mm_load_si128((__m128i *)a), cls) >> (p - a);
+    if (mask) {
+        return p + __builtin_ctz(mask);
+    }
+    for (;;) {
+        a += 16;
+        mask = stop_mask_sse2(_mm_load_si128((__m128i *)a), cls);
+        if (mask) {
+            return a + __builtin_ctz(mask);
+        }
+    }
+}
+
+#define SSE2_SCAN(name, cls)                    \
+    NO_ASAN static char *name##_sse2(char *p) { \
+        return scan_sse2(p, cls);               \
+    }
+
+SSE2_SCAN(skip_space, CLASS_SPACE)
+SSE2_SCAN(skip_ident, CLASS_IDENT)
+SSE2_SCAN(skip_digits, CLASS_DIGIT)
+SSE2_SCAN(find_newline, CLASS_LINE)
+SSE2_SCAN(find_star, CLASS_STAR)
+SSE2_SCAN(find_string_end, CLASS_STRING)
+
+//
+// AVX2 の実装
+// ほかのファイルは AVX2 なしでコンパイルするので、この部分の関数にだけ target をつける
+//
+
+#define AVX2 __attribute__((target("avx2")))
+
+AVX2 static inline __m256i in_range_avx2(__m256i x, char lo, char hi) {
+    __m256i t = _mm256_sub_epi8(x, _mm256_set1_epi8(lo));
+    return _mm256_cmpeq_epi8(_mm256_min_epu8(t, _mm256_set1_epi8(hi - lo)), t);
+}
+
+AVX2 static inline __m256i eq_avx2(__m256i x, char c) {
+    return _mm256_cmpeq_epi8(x, _mm256_set1_epi8(c));
+}
+
+AVX2 static inline unsigned stop_mask_avx2(__m256i x, CharClass cls) {
+    __m256i m;
+    switch (cls) {
+    case CLASS_SPACE:
+        m = _mm256_or_si256(eq_avx2(x, ' '), in_range_avx2(x, '\t', '\r'));
+        return ~_mm256_movemask_epi8(m);
+    case CLASS_IDENT:
+        m = in_range_avx2(_mm256_or_si256(x, _mm256_set1_epi8(0x20)), 'a', 'z');
+        m = _mm256_or_si256(m, in_range_avx2(x, '0', '9'));
+        m = _mm256_or_si256(m, eq_avx2(x, '_'));
+        return ~_mm256_movemask_epi8(m);
+    case CLASS_DIGIT:
+        return ~_mm256_movemask_epi8(in_range_avx2(x, '0', '9'));
+    case CLASS_LINE:
+        m = _mm256_or_si256(eq_avx2(x, '\n'), eq_avx2(x, '\0'));
+        return _mm256_movemask_epi8(m);
+    case CLASS_STAR:
+        m = _mm256_or_si256(eq_avx2(x, '*'), eq_avx2(x, '\0'));
+        return _mm256_movemask_epi8(m);
+    default:
+        m = _mm256_or_si256(eq_avx2(x, '"'), eq_avx2(x, '\\'));
+        m = _mm256_or_si256(m, eq_avx2(x, '\0'));
+        return _mm256_movemask_epi8(m);
+    }
+}
+
+NO_ASAN AVX2 static inline char *scan_avx2(char *p, CharClass cls) {
+    char *a = (char *)((uintptr_t)p & ~(uintptr_t)31);
+    unsigned mask = stop_mask_avx2(_mm256_load_si256((__m256i *)a), cls) >> (p - a);
+    if (mask) {
+        return p + __builtin_ctz(mask);
+    }
+    for (;;) {
+        a += 32;
+        mask = stop_mask_avx2(_mm256_load_si256((__m256i *)a), cls);
+        if (mask) {
+            return a + __builtin_ctz(mask);
+        }
+    }
+}
+
+#define AVX2_SCAN(name, cls)                         \
+    NO_ASAN AVX2 static char *name##_avx2(char *p) { \
+        return scan_avx2(p, cls);                    \
+    }
+
+AVX2_SCAN(skip_space, CLASS_SPACE)
+AVX2_SCAN(skip_ident, CLASS_IDENT)
+AVX2_SCAN(skip_digits, CLASS_DIGIT)
+AVX2_SCAN(find_newline, CLASS_LINE)
+AVX2_SCAN(find_star, CLASS_STAR)
+AVX2_SCAN(find_string_end, CLASS_STRING)
+#endif
+
+//
+// 実装の選択
+//
+
+#define SCAN_IMPL(suffix) {                                             \
+    #suffix, skip_space_##suffix, skip_ident_##suffix, skip_digits_##suffix, \
+    find_newline_##suffix, find_star_##suffix, find_string_end_##suffix,     \
+}
+
+static ScanImpl impls[] = {
+#ifdef __x86_64__
+    SCAN_IMPL(avx2),
+    SCAN_IMPL(sse2),
+#endif
+    SCAN_IMPL(scalar),
+};
+
+#define NUM_IMPLS (sizeof(impls) / sizeof(*impls))
+
+// 使っている実装
+// 起動時に一度だけ決め、以降はどのスレッドからも読むだけ
+ScanImpl scan;
+
+static bool is_supported(ScanImpl *impl) {
+#ifdef __x86_64__
+    if (!strcmp(impl->name, "avx2")) {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");
+    }
+#endif
+    return true;
+}
+
+// name という名前の実装に切り替える
+// ない実装か、この CPU では使えない実装なら false を返す
+// 字句解析をしているスレッドがない間に呼ぶ
+bool scan_select(char *name) {
+    for (int i = 0; i < NUM_IMPLS; i++) {
+        if (!strcmp(impls[i].name, name)) {
+            if (!is_supported(&impls[i])) {
+                return false;
+            }
+            scan = impls[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+// 使える中で最も速い実装を選ぶ
+// 環境変数 NINECC_SCAN で実装を指定することもできる(速さを比べるため)
+__attribute__((constructor))
+static void scan_init() {
+    char *name = getenv("NINECC_SCAN");
+    if (name && scan_select(name)) {
+        return;
+    }
+    for (int i = 0; i < NUM_IMPLS; i++) {
+        if (is_supported(&impls[i])) {
+            scan = impls[i];
+            return;
+        }
+    }
+}
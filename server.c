@@ -0,0 +1,224 @@
+#include <string.h>
+#include <signal.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/sysinfo.h>
+#include "9cc.h"
+#include "ninecc.h"
+
+// コンパイルサーバ
+// Unix ドメインソケットで待ち受け、送られてきたソースコードをコンパイルして返す
+// プロセスを起動し直さないので、起動のコストや、スレッドごとに持っている表や領域の確保を毎回払わなくてよい
+//
+// 1つの接続で1回だけ、次の形式でやりとりする(整数はホストのバイトオーダー)
+//   要求: u32 ファイル名の長さ, ファイル名, u32 コード生成のスレッド数, u64 ソースの長さ, ソース
+//   応答: u32 状態(0 なら成功), u64 本文の長さ, 本文(成功ならアセンブリ、失敗ならエラーメッセージ)
+
+// 1つのファイル名の長さの上限
+#define MAX_NAME_LEN 4096
+
+// 1つの要求のコード生成に使うスレッドの数の上限
+// 要求を同時に処理するワーカーで CPU を分け合うので、クライアントの指定はこれで抑える
+static int max_codegen_threads;
+
+static bool read_full(int fd, void *buf, size_t len) {
+    char *p = buf;
+    while (len > 0) {
+        ssize_t n = read(fd, p, len);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        p += n;
+        len -= n;
+    }
+    return true;
+}
+
+static bool write_full(int fd, void *buf, size_t len) {
+    char *p = buf;
+    while (len > 0) {
+        ssize_t n = write(fd, p, len);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        p += n;
+        len -= n;
+    }
+    return true;
+}
+
+static int unix_socket(char *path, struct sockaddr_un *addr) {
+    if (strlen(path) >= sizeof(addr->sun_path)) {
+        error("%s: socket path too long", path);
+    }
+    memset(addr, 0, sizeof(*addr));
+    addr->sun_family = AF_UNIX;
+    strcpy(addr->sun_path, path);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        error("socket: %s", strerror(errno));
+    }
+    return fd;
+}
+
+// コンパイルエラーのメッセージを応答に使うために控えておく
+static void save_error(void *arg, char *msg) {
+    *(char **)arg = strdup(msg);
+}
+
+// 1つの接続を処理する
+static void serve(int fd) {
+    uint32_t name_len;
+    uint32_t threads;
+    uint64_t src_len;
+    char name[MAX_NAME_LEN + 1];
+
+    if (!read_full(fd, &name_len, sizeof(name_len)) || name_len > MAX_NAME_LEN ||
+        !read_full(fd, name, name_len) ||
+        !read_full(fd, &threads, sizeof(threads)) ||
+        !read_full(fd, &src_len, sizeof(src_len))) {
+        return;
+    }
+    name[name_len] = '\0';
+
+    // 長さはクライアントが送ってきたものなので、確保できなければ応答せずに切断する
+    // 空のソースでも NULL にならないよう 1 バイト以上確保する
+    char *src = malloc(src_len ? src_len : 1);
+    if (!src) {
+        return;
+    }
+    if (!read_full(fd, src, src_len)) {
+        free(src);
+        return;
+    }
+
+    // 領域などはスレッドごとにあり、ninecc_compile が終わるたびに空にして次の要求で使い回す
+    // 0 (CPU の数に合わせる)や多すぎる指定のまま各ワーカーが CPU の数だけスレッドを作ると、
+    // 全体で CPU の数の2乗のスレッドになるので、サーバの割り当てを超えないようにする
+    codegen_threads = threads == 0 || threads > max_codegen_threads ? max_codegen_threads : threads;
+    char *out = NULL;
+    size_t out_len = 0;
+    char *msg = NULL;
+    uint32_t status = ninecc_compile(name, src, src_len, &out, &out_len, save_error, &msg) ? 1 : 0;
+    free(src);
+
+    char *body = status ? msg : out;
+    uint64_t len = status ? strlen(msg) : out_len;
+    if (write_full(fd, &status, sizeof(status)) && write_full(fd, &len, sizeof(len))) {
+        write_full(fd, body, len);
+    }
+    free(out);
+    free(msg);
+}
+
+// 待ち受けているソケットから接続を受け付けて処理し続ける
+// ワーカーがそれぞれ accept するので、接続は空いているワーカーに割り振られる
+static void *server_worker(void *arg) {
+    int sock = *(int *)arg;
+    for (;;) {
+        int fd = accept(sock, NULL, NULL);
+        if (fd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+            error("accept: %s", strerror(errno));
+        }
+        serve(fd);
+        close(fd);
+    }
+    return NULL;
+}
+
+// path で待ち受けるコンパイルサーバとして動く
+// nworkers 個の要求を同時に処理する、この関数からは戻らない
+void run_server(char *path, int nworkers) {
+    // 応答を書き込む前にクライアントが切断しても終了しないようにする
+    signal(SIGPIPE, SIG_IGN);
+
+    max_codegen_threads = get_nprocs() / nworkers;
+    if (max_codegen_threads < 1) {
+        max_codegen_threads = 1;
+    }
+
+    struct sockaddr_un addr;
+    int sock = unix_socket(path, &addr);
+
+    // 前に起動したサーバが残したソケットファイルは消してから作り直す
+    unlink(path);
+    if (bind(sock, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        error("%s: bind: %s", path, strerror(errno));
+    }
+    if (listen(sock, 128) < 0) {
+        error("%s: listen: %s", path, strerror(errno));
+    }
+
+    pthread_t thread;
+    for (int i = 1; i < nworkers; i++) {
+        if (pthread_create(&thread, NULL, server_worker, &sock)) {
+            error("cannot create a server thread");
+        }
+    }
+    server_worker(&sock);
+}
+
+// path で待ち受けているサーバにファイル name のソースコード src をコンパイルしてもらう
+// 成功したらアセンブリを output(NULL なら標準出力)に書き出し、
+// object なら受け取ったアセンブリをここでアセンブルしてオブジェクトファイルを書き出す
+// コンパイルエラーならメッセージを表示して終了する
+// サーバにつながらなかったときは false を返すので、呼び出し側で自分でコンパイルする
+bool run_client(char *path, char *name, char *src, size_t src_len, char *output, bool object) {
+    struct sockaddr_un addr;
+    int fd = unix_socket(path, &addr);
+    if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        close(fd);
+        return false;
+    }
+
+    uint32_t name_len = strlen(name);
+    uint32_t threads = codegen_threads;
+    uint64_t len = src_len;
+    if (name_len > MAX_NAME_LEN ||
+        !write_full(fd, &name_len, sizeof(name_len)) ||
+        !write_full(fd, name, name_len) ||
+        !write_full(fd, &threads, sizeof(threads)) ||
+        !write_full(fd, &len, sizeof(len)) ||
+        !write_full(fd, src, src_len)) {
+        close(fd);
+        return false;
+    }
+
+    uint32_t status;
+    if (!read_full(fd, &status, sizeof(status)) || !read_full(fd, &len, sizeof(len))) {
+        close(fd);
+        return false;
+    }
+    // 長さは受け取ったものなので、確保できない大きさかもしれない
+    char *body = len < SIZE_MAX ? malloc(len + 1) : NULL;
+    if (!body || !read_full(fd, body, len)) {
+        free(body);
+        close(fd);
+        return false;
+    }
+    body[len] = '\0';
+    close(fd);
+
+    if (status) {
+        error("%s", body);
+    }
+
+    emit_open(output, object);
+    emit(body);
+    emit_close();
+    free(body);
+    return true;
+}
@@ -0,0 +1,106 @@
+#include <string.h>
+#include <time.h>
+#include "9cc.h"
+#include "utility.h"
+
+// コンパイルのフェーズごとの時間と、各種のカウンタ
+// コンパイルはスレッドごとに行うので、集計もスレッドごとに持つ
+_Thread_local Stats stats;
+
+static char *phase_names[] = {
+    "tokenize",
+    "parse",
+    "cache",
+    "add_type",
+    "offsets",
+    "codegen",
+    "assemble",
+};
+
+char *phase_name(Phase phase) {
+    return phase_names[phase];
+}
+
+double now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// 次のコンパイルのために集計を空にする
+// 計測するかどうかの設定は残す
+void reset_stats() {
+    bool enabled = stats.enabled;
+    memset(&stats, 0, sizeof(stats));
+    stats.enabled = enabled;
+}
+
+static double total_time() {
+    double total = 0;
+    for (int i = 0; i < PHASE_NUM; i++) {
+        total += stats.phase_time[i];
+    }
+    return total;
+}
+
+static double avg_chain() {
+    return stats.lookups ? (double)stats.lookup_steps / stats.lookups : 0;
+}
+
+// 人が読むための表を出力する
+void print_time_report(FILE *fp, char *path) {
+    double total = total_time();
+
+    fprintf(fp, "%s:\n", path);
+    for (int i = 0; i < PHASE_NUM; i++) {
+        fprintf(fp, "  %-10s %10.3f ms %6.1f%%\n", phase_names[i], stats.phase_time[i] * 1e3,
+                total > 0 ? stats.phase_time[i] / total * 100 : 0);
+    }
+    fprintf(fp, "  %-10s %10.3f ms\n", "total", total * 1e3);
+
+    fprintf(fp, "  tokens        %ld\n", stats.tokens);
+    fprintf(fp, "  types         %ld\n", stats.types);
+    fprintf(fp, "  scope lookups %ld (avg chain %.2f)\n", stats.lookups, avg_chain());
+    fprintf(fp, "  instructions  %ld\n", stats.insns);
+    fprintf(fp, "  cache         %ld hits, %ld misses\n", stats.cache_hits, stats.cache_misses);
+
+    long nodes = 0;
+    for (int i = 0; i < ND_KIND_NUM; i++) {
+        nodes += stats.nodes[i];
+    }
+    fprintf(fp, "  nodes         %ld\n", nodes);
+    for (int i = 0; i < ND_KIND_NUM; i++) {
+        if (stats.nodes[i]) {
+            fprintf(fp, "    %-12s %ld\n", node_kind_name(i), stats.nodes[i]);
+        }
+    }
+}
+
+// ダッシュボードなどで集計するための JSON を1行で出力する
+void print_stats_json(FILE *fp, char *path) {
+    fprintf(fp, "{\"file\":\"");
+    for (char *p = path; *p; p++) {
+        if (*p == '"' || *p == '\\') {
+            fputc('\\', fp);
+        }
+        fputc(*p, fp);
+    }
+    fprintf(fp, "\",\"time_ms\":{");
+    for (int i = 0; i < PHASE_NUM; i++) {
+        fprintf(fp, "\"%s\":%.3f,", phase_names[i], stats.phase_time[i] * 1e3);
+    }
+    fprintf(fp, "\"total\":%.3f}", total_time() * 1e3);
+
+    fprintf(fp, ",\"tokens\":%ld,\"types\":%ld", stats.tokens, stats.types);
+    fprintf(fp, ",\"scope_lookups\":%ld,\"avg_chain\":%.3f", stats.lookups, avg_chain());
+    fprintf(fp, ",\"cache_hits\":%ld,\"cache_misses\":%ld", stats.cache_hits, stats.cache_misses);
+    fprintf(fp, ",\"instructions\":%ld,\"nodes\":{", stats.insns);
+    bool first = true;
+    for (int i = 0; i < ND_KIND_NUM; i++) {
+        if (stats.nodes[i]) {
+            fprintf(fp, "%s\"%s\":%ld", first ? "" : ",", node_kind_name(i), stats.nodes[i]);
+            first = false;
+        }
+    }
+    fprintf(fp, "}}\n");
+}
@@ -0,0 +1,147 @@
+// libninecc.a の API のテスト
+//
+// 同じスレッドで ninecc_compile を、成功するソース、エラーになるソース、成功するソースの順に呼び、
+// エラーで longjmp したあともスレッドごとの状態が壊れず、同じ出力が得られることを確かめる
+// さらに複数のスレッドから同時に、成功するソースとエラーになるソースを混ぜてコンパイルし、
+// どのスレッドの出力も1つのスレッドでコンパイルしたものと同じになることを確かめる
+//
+// $ make test
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "ninecc.h"
+
+// 同時にコンパイルするスレッドの数と、スレッドごとのコンパイルの回数
+#define NTHREADS 8
+#define NCOMPILES 300
+
+static char good[] =
+    "int g = 3;\n"
+    "char *msg = \"hello\";\n"
+    "int add(int a, int b) { return a + b; }\n"
+    "int main() { int x = add(g, 4); return x; }\n";
+
+// スレッドの間で出力が混ざればわかるよう、もう1つ別の出力になるソースを用意する
+static char good2[] =
+    "struct pair { int a; int b; } gp;\n"
+    "char names[3][4] = {\"ab\", \"cd\", \"ef\"};\n"
+    "int sum(struct pair *p) { return p->a + p->b; }\n"
+    "int main() { gp.a = 1; gp.b = 2; return sum(&gp) + names[1][0]; }\n";
+
+// 関数の本体をパースしている途中でエラーになる
+// 前のグローバル変数と関数はパースし終わっていて、スコープやトークンの状態が残っている
+static char bad[] =
+    "int h = 5;\n"
+    "int f(int x) { return x * 2; }\n"
+    "int main() { int y = f(h) + ; return y; }\n";
+
+static int nerrors;
+
+static void on_error(void *arg, char *msg) {
+    nerrors++;
+    fprintf(stderr, "expected error: %s\n", msg);
+}
+
+static void fail(char *msg) {
+    fprintf(stderr, "libninecc test: %s\n", msg);
+    exit(1);
+}
+
+// 1つのスレッドでコンパイルした、比べるための出力
+static char *ref[2];
+static size_t ref_len[2];
+
+// 複数のスレッドからのエラーは、メッセージを表示せずにスレッドごとに数える
+static void count_error(void *arg, char *msg) {
+    (*(int *)arg)++;
+}
+
+static void *compile_worker(void *arg) {
+    int id = *(int *)arg;
+    int errors = 0;
+    int nbad = 0;
+    for (int i = 0; i < NCOMPILES; i++) {
+        // スレッドごとにずらして、同じ瞬間に違う種類のソースをコンパイルするようにする
+        int kind = (i + id) % 3;
+        char *out = NULL;
+        size_t len;
+        if (kind == 2) {
+            nbad++;
+            if (!ninecc_compile("bad.c", bad, strlen(bad), &out, &len, count_error, &errors)) {
+                fail("bad source compiled in a thread");
+            }
+            if (errors != nbad || out) {
+                fail("error callback was not called exactly once in a thread");
+            }
+            continue;
+        }
+        char *src = kind == 0 ? good : good2;
+        if (ninecc_compile("good.c", src, strlen(src), &out, &len, count_error, &errors)) {
+            fail("compile failed in a thread");
+        }
+        if (len != ref_len[kind] || memcmp(out, ref[kind], len)) {
+            fail("output in a thread differs from the single-threaded one");
+        }
+        free(out);
+    }
+    ninecc_release();
+    return NULL;
+}
+
+int main() {
+    char *first;
+    size_t first_len;
+    if (ninecc_compile("good.c", good, strlen(good), &first, &first_len, on_error, NULL)) {
+        fail("first compile failed");
+    }
+    if (first_len != strlen(first) || !strstr(first, "add:")) {
+        fail("first compile produced unexpected output");
+    }
+
+    char *out = NULL;
+    size_t len;
+    if (!ninecc_compile("bad.c", bad, strlen(bad), &out, &len, on_error, NULL)) {
+        fail("bad source compiled");
+    }
+    if (nerrors != 1 || out) {
+        fail("error callback was not called exactly once");
+    }
+
+    char *second;
+    size_t second_len;
+    if (ninecc_compile("good.c", good, strlen(good), &second, &second_len, on_error, NULL)) {
+        fail("compile after an error failed");
+    }
+    if (second_len != first_len || memcmp(first, second, first_len)) {
+        fail("output changed after an error");
+    }
+
+    free(second);
+
+    // 複数のスレッドから同時に呼ぶ
+    ref[0] = first;
+    ref_len[0] = first_len;
+    if (ninecc_compile("good.c", good2, strlen(good2), &ref[1], &ref_len[1], on_error, NULL)) {
+        fail("second source failed to compile");
+    }
+    ninecc_release();
+
+    pthread_t threads[NTHREADS];
+    int ids[NTHREADS];
+    for (int i = 0; i < NTHREADS; i++) {
+        ids[i] = i;
+        if (pthread_create(&threads[i], NULL, compile_worker, &ids[i])) {
+            fail("cannot create a thread");
+        }
+    }
+    for (int i = 0; i < NTHREADS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    free(ref[0]);
+    free(ref[1]);
+    printf("OK\n");
+    return 0;
+}
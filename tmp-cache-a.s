@@ -0,0 +1,26 @@
+.intel_syntax noprefix
+.section .rodata
+  .type g, @object
+  .size g, 4
+  .align 4
+g:
+  .long 1
+.text
+.globl f
+f:
+# prologue
+  push rbp
+  mov rbp, rsp
+  sub rsp, 0
+# program body
+  push offset g
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  jmp .Lreturn.f
+# epilogue
+.Lreturn.f:
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,21560 @@
+.intel_syntax noprefix
+.data
+  .type g17, @object
+  .size g17, 16
+  .align 4
+g17:
+  .quad 8589934593, 17179869187
+  .type g16, @object
+  .size g16, 16
+g16:
+  .asciz "ab"
+  .quad 28256349322215424
+  .long 0
+  .byte 0
+  .type g12, @object
+  .size g12, 16
+  .align 4
+g12:
+  .quad 8589934593, 17179869187
+  .type g11, @object
+  .size g11, 16
+  .align 4
+g11:
+  .quad 8589934593, 17179869187
+  .type g5, @object
+  .size g5, 4
+  .align 4
+g5:
+  .long 5
+.section .data.rel.ro,"aw"
+  .type g10, @object
+  .size g10, 16
+  .align 8
+g10:
+  .quad .L.data.1
+  .quad .L.data.2
+  .type g8, @object
+  .size g8, 8
+  .align 8
+g8:
+  .quad .L.data.0
+  .type g7, @object
+  .size g7, 8
+  .align 8
+g7:
+  .quad g5
+.section .rodata
+.L.data.main.130:
+  .zero 2
+  .type g15, @object
+  .size g15, 144
+  .align 8
+g15:
+  .byte 1
+  .zero 135
+  .quad -1
+  .type g14, @object
+  .size g14, 6
+g14:
+  .asciz "a\042b"
+  .zero 2
+  .type g13, @object
+  .size g13, 4
+g13:
+  .asciz "abc"
+  .type g9, @object
+  .size g9, 12
+  .align 4
+g9:
+  .quad 4294967296
+  .long 2
+  .type g6, @object
+  .size g6, 8
+  .align 8
+g6:
+  .quad 6
+  .type g4, @object
+  .size g4, 2
+  .align 2
+g4:
+  .short 4
+  .type g3, @object
+  .size g3, 1
+g3:
+  .byte 3
+.section .rodata.str1.1,"aMS",@progbits,1
+.L.data.main.405:
+  .asciz "OK\012"
+.L.data.main.404:
+  .asciz "g17[1][1]"
+.L.data.main.403:
+  .asciz "int *p=g17[1]; *p=9; g17[1][0];"
+.L.data.main.402:
+  .asciz "strcpy(g16[1], \042xy\042); strcmp(g16[1], \042xy\042);"
+.L.data.main.401:
+  .asciz "xy"
+.L.data.main.400:
+  .asciz "xy"
+.L.data.main.399:
+  .asciz "g15[17]"
+.L.data.main.398:
+  .asciz "g15[16]"
+.L.data.main.397:
+  .asciz "g15[0]"
+.L.data.main.396:
+  .asciz "sizeof(g15)"
+.L.data.main.395:
+  .asciz "g14[5]"
+.L.data.main.394:
+  .asciz "g14[1]"
+.L.data.main.393:
+  .asciz "sizeof(g14)"
+.L.data.main.392:
+  .asciz "g13[3]"
+.L.data.main.391:
+  .asciz "g13[2]"
+.L.data.main.390:
+  .asciz "sizeof(g13)"
+.L.data.main.389:
+  .asciz "g12[1].a[1]"
+.L.data.main.388:
+  .asciz "g12[1].a[0]"
+.L.data.main.387:
+  .asciz "g12[0].a[1]"
+.L.data.main.386:
+  .asciz "g12[0].a[0]"
+.L.data.main.385:
+  .asciz "g11[1].b"
+.L.data.main.384:
+  .asciz "g11[1].a"
+.L.data.main.383:
+  .asciz "g11[0].b"
+.L.data.main.382:
+  .asciz "g11[0].a"
+.L.data.main.381:
+  .asciz "sizeof(g10) / sizeof(*g10)"
+.L.data.main.380:
+  .asciz "g10[1][3]"
+.L.data.main.379:
+  .asciz "strcmp(g10[1], \042bar\042)"
+.L.data.main.378:
+  .asciz "bar"
+.L.data.main.377:
+  .asciz "strcmp(g10[0], \042foo\042)"
+.L.data.main.376:
+  .asciz "foo"
+.L.data.main.375:
+  .asciz "g9[2]"
+.L.data.main.374:
+  .asciz "g9[1]"
+.L.data.main.373:
+  .asciz "g9[0]"
+.L.data.main.372:
+  .asciz "strcmp(g8, \042abc\042)"
+.L.data.main.371:
+  .asciz "abc"
+.L.data.main.370:
+  .asciz "*g7"
+.L.data.main.369:
+  .asciz "g6"
+.L.data.main.368:
+  .asciz "g5"
+.L.data.main.367:
+  .asciz "g4"
+.L.data.main.366:
+  .asciz "g3"
+.L.data.main.365:
+  .asciz "struct {int a; int b;} x[2]={{1,2}}; x[1].b;"
+.L.data.main.364:
+  .asciz "struct {int a; int b;} x[2]={{1,2},{3,4}}; x[1].b;"
+.L.data.main.363:
+  .asciz "struct {int a; int b;} x[2]={{1,2},{3,4}}; x[1].a;"
+.L.data.main.362:
+  .asciz "struct {int a; int b;} x[2]={{1,2},{3,4}}; x[0].b;"
+.L.data.main.361:
+  .asciz "struct {int a; int b;} x[2]={{1,2},{3,4}}; x[0].a;"
+.L.data.main.360:
+  .asciz "struct {int a; int b; int c;} x={1}; x.c;"
+.L.data.main.359:
+  .asciz "struct {int a; int b; int c;} x={1}; x.b;"
+.L.data.main.358:
+  .asciz "struct {int a; int b; int c;} x={1}; x.a;"
+.L.data.main.357:
+  .asciz "struct {int a; int b; int c;} x={1,2,3}; x.c;"
+.L.data.main.356:
+  .asciz "struct {int a; int b; int c;} x={1,2,3}; x.b;"
+.L.data.main.355:
+  .asciz "struct {int a; int b; int c;} x={1,2,3}; x.a;"
+.L.data.main.354:
+  .asciz "char x[]=\042foo\042; sizeof(x); }"
+.L.data.main.353:
+  .asciz "int x[]={1,2,3,4}; sizeof(x);"
+.L.data.main.352:
+  .asciz "int x[]={1,2,3,4}; x[3];"
+.L.data.main.351:
+  .asciz "char x[2][4]=\042abc\042,\042def\042}; x[1][2]; }"
+.L.data.main.350:
+  .asciz "char x[2][4]=\042abc\042,\042def\042}; x[1][0]; }"
+.L.data.main.349:
+  .asciz "char x[2][4]=\042abc\042,\042def\042}; x[0][3]; }"
+.L.data.main.348:
+  .asciz "char x[2][4]=\042abc\042,\042def\042}; x[0][0]; }"
+.L.data.main.347:
+  .asciz "char x[4]=\042abc\042; x[3]; }"
+.L.data.main.346:
+  .asciz "char x[4]=\042abc\042; x[2]; }"
+.L.data.main.345:
+  .asciz "char x[4]=\042abc\042; x[0]; }"
+.L.data.main.344:
+  .asciz "int x[2][3]={{1}}; x[1][2];"
+.L.data.main.343:
+  .asciz "int x[2][3]={{1}}; x[1][1];"
+.L.data.main.342:
+  .asciz "int x[2][3]={{1}}; x[1][0];"
+.L.data.main.341:
+  .asciz "int x[2][3]={{1}}; x[0][2];"
+.L.data.main.340:
+  .asciz "int x[2][3]={{1}}; x[0][1];"
+.L.data.main.339:
+  .asciz "int x[2][3]={{1}}; x[0][0];"
+.L.data.main.338:
+  .asciz "int x[2][3]={{1,2}}; x[1][2];"
+.L.data.main.337:
+  .asciz "int x[2][3]={{1,2}}; x[1][0];"
+.L.data.main.336:
+  .asciz "int x[2][3]={{1,2}}; x[0][1];"
+.L.data.main.335:
+  .asciz "int x[2][3]={{1,2,3},{4,5,6}}; x[1][2];"
+.L.data.main.334:
+  .asciz "int x[2][3]={{1,2,3},{4,5,6}}; x[1][0];"
+.L.data.main.333:
+  .asciz "int x[2][3]={{1,2,3},{4,5,6}}; x[0][1];"
+.L.data.main.332:
+  .asciz "int x[3]={1,2,3}; x[0];"
+.L.data.main.331:
+  .asciz "int x[3]={1,2,3}; x[0];"
+.L.data.main.330:
+  .asciz "int x[3]={1,2,3}; x[0];"
+.L.data.main.329:
+  .asciz "int x[3]={1,2,3}; x[0];"
+.L.data.main.328:
+  .asciz "char x[1?2:3]; sizeof(x);"
+.L.data.main.327:
+  .asciz "char x[0?2:3]; sizeof(x);"
+.L.data.main.326:
+  .asciz "int x[1+1]; sizeof(x);"
+.L.data.main.325:
+  .asciz "int i=0; switch(3) { case 5-2+0*3: i++; ); i;"
+.L.data.main.324:
+  .asciz "enum { ten=1+2+3+4, }; ten;"
+.L.data.main.323:
+  .asciz "0?1:2"
+.L.data.main.322:
+  .asciz "0?1:2"
+.L.data.main.321:
+  .asciz "int i=1; i>>1;"
+.L.data.main.320:
+  .asciz "int i=-1; i;"
+.L.data.main.319:
+  .asciz "-1"
+.L.data.main.318:
+  .asciz "int i=5; i>>1;"
+.L.data.main.317:
+  .asciz "int i=5; i<<1;"
+.L.data.main.316:
+  .asciz "int i=1; i<<3;"
+.L.data.main.315:
+  .asciz "int i=1; i<<0;"
+.L.data.main.314:
+  .asciz "-1>>1"
+.L.data.main.313:
+  .asciz "5>>1"
+.L.data.main.312:
+  .asciz "5<<1"
+.L.data.main.311:
+  .asciz "1<<3"
+.L.data.main.310:
+  .asciz "1<<0"
+.L.data.main.309:
+  .asciz "int i=0; switch(1) { case 0:i=5;break; default:i=7; } i;"
+.L.data.main.308:
+  .asciz "int i=0; switch(0) { case 0:i=5;break; default:i=7; } i;"
+.L.data.main.307:
+  .asciz "int i=0; switch(3) { case 0:i=5;break; case 1:i=6;break; case 2:i=7;break; } i;"
+.L.data.main.306:
+  .asciz "int i=0; switch(2) { case 0:i=5;break; case 1:i=6;break; case 2:i=7;break; } i;"
+.L.data.main.305:
+  .asciz "int i=0; switch(1) { case 0:i=5;break; case 1:i=6;break; case 2:i=7;break; } i;"
+.L.data.main.304:
+  .asciz "int i=0; switch(0) { case 0:i=5;break; case 1:i=6;break; case 2:i=7;break; } i;"
+.L.data.main.303:
+  .asciz "int i=0; goto g; h: i++; i: i++; j: i++; i;"
+.L.data.main.302:
+  .asciz "int i=0; goto d; d: i++; e: i++; f: i++; i;"
+.L.data.main.301:
+  .asciz "int i=0; goto a; a: i++; b: i++; c: i++; i;"
+.L.data.main.300:
+  .asciz "int i=0; int j=0; while(!i) { while (j++!=10) continue; break; } j;"
+.L.data.main.299:
+  .asciz "int i=0; int j=0; while (i++<10) { if (i>5) continue; j++; } j;"
+.L.data.main.298:
+  .asciz "int i=0; int j=0; while (i++<10) { if (i>5) continue; j++; } i;"
+.L.data.main.297:
+  .asciz "int i=0; int j=0; for(;!i;) { for (;j!=10;j++) continue; break; } j;"
+.L.data.main.296:
+  .asciz "int i=0; int j=0; for (;i<10;i++) { if (i>5) continue; j++; } j;"
+.L.data.main.295:
+  .asciz "int i=0; int j=0; for (;i<10;i++) { if (i>5) continue; j++; } i;"
+.L.data.main.294:
+  .asciz "int i=0; while { if (i == 3) break; } i;"
+.L.data.main.293:
+  .asciz "int i=0; for(;i<10;i++) { if (i == 3) break; } i;"
+.L.data.main.292:
+  .asciz "int i=0; while { if (i == 3) break; } i;"
+.L.data.main.291:
+  .asciz "int i=0; for(;i<10;i++) { if (i == 3) break; } i;"
+.L.data.main.290:
+  .asciz "struct T { struct T *next; int x; } a; struct T b; b.x=1; a.next=&b; a.next->x;"
+.L.data.main.289:
+  .asciz "struct T *foo; struct T {int x;}; sizeof(struct T);"
+.L.data.main.288:
+  .asciz "struct *foo; sizeof(foo);"
+.L.data.main.287:
+  .asciz "int x[2]; x[0]=3; param_decay(x);"
+.L.data.main.286:
+  .asciz "1&&5"
+.L.data.main.285:
+  .asciz "(2-2)&&5"
+.L.data.main.284:
+  .asciz "0&&1"
+.L.data.main.283:
+  .asciz "0||(2-2)"
+.L.data.main.282:
+  .asciz "0||0"
+.L.data.main.281:
+  .asciz "0||(2-2)||5"
+.L.data.main.280:
+  .asciz "0||1"
+.L.data.main.279:
+  .asciz "7^5"
+.L.data.main.278:
+  .asciz "7^3"
+.L.data.main.277:
+  .asciz "8^8"
+.L.data.main.276:
+  .asciz "0^0"
+.L.data.main.275:
+  .asciz "1|3"
+.L.data.main.274:
+  .asciz "2|1"
+.L.data.main.273:
+  .asciz "0|1"
+.L.data.main.272:
+  .asciz " -1&10"
+.L.data.main.271:
+  .asciz "7&3"
+.L.data.main.270:
+  .asciz "3&1"
+.L.data.main.269:
+  .asciz "0&1"
+.L.data.main.268:
+  .asciz "~-1"
+.L.data.main.267:
+  .asciz "~0"
+.L.data.main.266:
+  .asciz "!0"
+.L.data.main.265:
+  .asciz "!2"
+.L.data.main.264:
+  .asciz "!1"
+.L.data.main.263:
+  .asciz "int i=6; i/=2;"
+.L.data.main.262:
+  .asciz "int i=6; i/=2; i;"
+.L.data.main.261:
+  .asciz "int i=3; i*=2;"
+.L.data.main.260:
+  .asciz "int i=3; i*=2; i;"
+.L.data.main.259:
+  .asciz "int i=5; i-=2;"
+.L.data.main.258:
+  .asciz "int i=5; i-=2; i;"
+.L.data.main.257:
+  .asciz "int i=2; i+=5;"
+.L.data.main.256:
+  .asciz "int i=2; i+=5; i;"
+.L.data.main.255:
+  .asciz "int a[3]; a[0]=0; a[1]=1; a[2]=2; int *p=a+1; (*p++); a[0];"
+.L.data.main.254:
+  .asciz "int a[3]; a[0]=0; a[1]=1; a[2]=2; int *p=a+1; (*p++); a[0];"
+.L.data.main.253:
+  .asciz "int a[3]; a[0]=0; a[1]=1; a[2]=2; int *p=a+1; (*p++); a[0];"
+.L.data.main.252:
+  .asciz "int a[3]; a[0]=0; a[1]=1; a[2]=2; int *p=a+1; (*p++); a[0];"
+.L.data.main.251:
+  .asciz "int a[3]; a[0]=0; a[1]=1; a[2]=2; int *p=a+1; --*p;"
+.L.data.main.250:
+  .asciz "int a[3]; a[0]=0; a[1]=1; a[2]=2; int *p=a+1; *p--;"
+.L.data.main.249:
+  .asciz "int a[3]; a[0]=0; a[1]=1; a[2]=2; int *p=a+1; ++*p;"
+.L.data.main.248:
+  .asciz "int a[3]; a[0]=0; a[1]=1; a[2]=2; int *p=a+1; *p++;"
+.L.data.main.247:
+  .asciz "int i=2; i--; i;"
+.L.data.main.246:
+  .asciz "int i=2; i++; i;"
+.L.data.main.245:
+  .asciz "int i=2; i--;"
+.L.data.main.244:
+  .asciz "int i=2; i++;"
+.L.data.main.243:
+  .asciz "int i=2; --i;"
+.L.data.main.242:
+  .asciz "int i=2; ++i;"
+.L.data.main.241:
+  .asciz "(1,2,3)"
+.L.data.main.240:
+  .asciz "int i=3; int j=0; for (int i=0; i<=10; i=i+1) j=j+i; i;"
+.L.data.main.239:
+  .asciz "int j=0; for (int i=0; i<=10; i=i+1) j=j+i; j;"
+.L.data.main.238:
+  .asciz "count()"
+.L.data.main.237:
+  .asciz "count()"
+.L.data.main.236:
+  .asciz "count()"
+.L.data.main.235:
+  .asciz "enum t { zero, one, two }; enum t y; sizeof(y);"
+.L.data.main.234:
+  .asciz "enum { zero, one, two } x; sizeof(x);"
+.L.data.main.233:
+  .asciz "enum { zero, five=5, three=3, four }; four;"
+.L.data.main.232:
+  .asciz "enum { zero, five=5, three=3, four }; three;"
+.L.data.main.231:
+  .asciz "enum { zero, five=5, three=3, four }; five;"
+.L.data.main.230:
+  .asciz "enum { zero, five=5, three=3, four }; zero;"
+.L.data.main.229:
+  .asciz "enum { five=5, six, seven }; six;"
+.L.data.main.228:
+  .asciz "enum { five=5, six, seven }; five;"
+.L.data.main.227:
+  .asciz "enum { zero, one, two }; two;"
+.L.data.main.226:
+  .asciz "enum { zero, one, two }; one;"
+.L.data.main.225:
+  .asciz "enum { zero, one, two }; zero;"
+.L.data.main.224:
+  .asciz "char_fn()"
+.L.data.main.223:
+  .asciz "'\134n'"
+.L.data.main.222:
+  .asciz "'a'"
+.L.data.main.221:
+  .asciz "int x=5; long y=(long)&x; *(int*)y"
+.L.data.main.220:
+  .asciz "(long)&*(int *)0"
+.L.data.main.219:
+  .asciz "(long)1"
+.L.data.main.218:
+  .asciz "(_Bool)(char)256"
+.L.data.main.217:
+  .asciz "(_Bool)2"
+.L.data.main.216:
+  .asciz "(_Bool)1"
+.L.data.main.215:
+  .asciz "(char)8590066177"
+.L.data.main.214:
+  .asciz "(short)8590066177"
+.L.data.main.213:
+  .asciz "(int)8590066177"
+.L.data.main.212:
+  .asciz "sizeof(4294967297)"
+.L.data.main.211:
+  .asciz "4294967297"
+.L.data.main.210:
+  .asciz "sizeof(0)"
+.L.data.main.209:
+  .asciz "sizeof(int[3][4])"
+.L.data.main.208:
+  .asciz "sizeof(int[4])"
+.L.data.main.207:
+  .asciz "sizeof(int(*)[4])"
+.L.data.main.206:
+  .asciz "sizeof(int(*)[4])"
+.L.data.main.205:
+  .asciz "sizeof(int **)"
+.L.data.main.204:
+  .asciz "sizeof(long *)"
+.L.data.main.203:
+  .asciz "sizeof(int *)"
+.L.data.main.202:
+  .asciz "sizeof(char *)"
+.L.data.main.201:
+  .asciz "sizeof(long int)"
+.L.data.main.200:
+  .asciz "sizeof(long int)"
+.L.data.main.199:
+  .asciz "sizeof(long)"
+.L.data.main.198:
+  .asciz "sizeof(int)"
+.L.data.main.197:
+  .asciz "sizeof(int short)"
+.L.data.main.196:
+  .asciz "sizeof(short int)"
+.L.data.main.195:
+  .asciz "sizeof(short)"
+.L.data.main.194:
+  .asciz "sizeof(char)"
+.L.data.main.193:
+  .asciz "int long x; sizeof(x);"
+.L.data.main.192:
+  .asciz "long int x; sizeof(x);"
+.L.data.main.191:
+  .asciz "typedef t; t x; sizeof(x);"
+.L.data.main.190:
+  .asciz "int x; sizeof(x);"
+.L.data.main.189:
+  .asciz "int short x; sizeof(x);"
+.L.data.main.188:
+  .asciz "short int x; sizeof(x);"
+.L.data.main.187:
+  .asciz "char x; sizeof(x);"
+.L.data.main.186:
+  .asciz "_Bool x=2; x;"
+.L.data.main.185:
+  .asciz "_Bool x=1; x;"
+.L.data.main.184:
+  .asciz "_Bool x=0; x;"
+.L.data.main.183:
+  .asciz "*g1_ptr()"
+.L.data.main.182:
+  .asciz "int x[3]; int (*y)[3]=x; y[0][0]=4; y[0][0];"
+.L.data.main.181:
+  .asciz "int *x[3]; int y; x[0]=&y; y=3; x[0][0];"
+.L.data.main.180:
+  .asciz "int (*x)[3]; sizeof(x);"
+.L.data.main.179:
+  .asciz "int *x[3]; sizeof(x);"
+.L.data.main.178:
+  .asciz "sub_long(7, 3, 3)"
+.L.data.main.177:
+  .asciz "sub_short(7, 3, 3)"
+.L.data.main.176:
+  .asciz "struct {char a; long b} x; sizeof(x);"
+.L.data.main.175:
+  .asciz "long x; sizeof(x);"
+.L.data.main.174:
+  .asciz "struct {char a; short b;} x; sizeof(x);"
+.L.data.main.173:
+  .asciz "short x; sizeof(x);"
+.L.data.main.172:
+  .asciz "struct t {int a; int b;}; struct t y; sizeof(y);"
+.L.data.main.171:
+  .asciz "struct t {int a; int b;} x; struct t y; sizeof(y);"
+.L.data.main.170:
+  .asciz "typedef struct {int a;} t; { typedef int t; } t x; x.a=2; x.a;"
+.L.data.main.169:
+  .asciz "typedef int t; t t=1; t;"
+.L.data.main.168:
+  .asciz "typedef struct {int a;} t; t x; x.a=1; x.a;"
+.L.data.main.167:
+  .asciz "typedef int t; t x=1; x;"
+.L.data.main.166:
+  .asciz "struct t {char a;} x; struct t *y = &x; y->a=3; x.a;"
+.L.data.main.165:
+  .asciz "struct t {char a;} x; struct t *y = &x; x.a=3; y->a;"
+.L.data.main.164:
+  .asciz "struct t {int x;}; int t=1; struct t y; y.x=2; t+y.x;"
+.L.data.main.163:
+  .asciz "struct t {char a[2];}; { struct t {char a[4];}; } struct t y; sizeof(y);"
+.L.data.main.162:
+  .asciz "char x; int y; int a=&x; int b=&y; b-a;"
+.L.data.main.161:
+  .asciz "int x; char y; int a=&x; int b=&y; b-a;"
+.L.data.main.160:
+  .asciz "struct {int a; char b;} x; sizeof(x);"
+.L.data.main.159:
+  .asciz "struct {char a; int b;} x; sizeof(x);"
+.L.data.main.158:
+  .asciz "struct {char a; char b;} x; sizeof(x);"
+.L.data.main.157:
+  .asciz "struct {int a[3];} x[2]; sizeof(x)};"
+.L.data.main.156:
+  .asciz "struct {int a;} x[4]; sizeof(x);"
+.L.data.main.155:
+  .asciz "struct {int a[3];} x; sizeof(x);"
+.L.data.main.154:
+  .asciz "struct {int a; int b;} x; sizeof(x);"
+.L.data.main.153:
+  .asciz "struct {int a;} x; sizeof(x);"
+.L.data.main.152:
+  .asciz "struct { struct { int b; } a; } x; x.a.b=6; x.a.b;"
+.L.data.main.151:
+  .asciz "struct {int a[3]; int b[5];} x; int *p=&x; x.b[0]=7; p[3];"
+.L.data.main.150:
+  .asciz "struct {int a[3]; int b[5];} x; int *p=&x; x.a[0]=6; p[0];"
+.L.data.main.149:
+  .asciz "struct {int a; int b;} x[3]; int *p=x; p[3]=3; x[1].b;"
+.L.data.main.148:
+  .asciz "struct {int a; int b;} x[3]; int *p=x; p[2]=2; x[1].a;"
+.L.data.main.147:
+  .asciz "struct {int a; int b;} x[3]; int *p=x; p[1]=1; x[0].b;"
+.L.data.main.146:
+  .asciz "struct {int a; int b;} x[3]; int *p=x; p[0]=0; x[0].a;"
+.L.data.main.145:
+  .asciz "struct {char a; int b; char c;} x; x.a=1; x.b=2; x.c=3; x.c;"
+.L.data.main.144:
+  .asciz "struct {char a; int b; char c;} a; x.b=x; x.a=2; x.b=3; x.b;"
+.L.data.main.143:
+  .asciz "struct {char a; int b; char c;} x; x.a=1; x.b=2; x.c=3; x.a;"
+.L.data.main.142:
+  .asciz "struct {int a; int b;} x; x.a=1; x.b=2; x.b;"
+.L.data.main.141:
+  .asciz "struct {int a; int b;} x; x.a=1; x.b=2; x.a;"
+.L.data.main.140:
+  .asciz "int x=2; { x=3; } x;"
+.L.data.main.139:
+  .asciz "int x=2; { int x=3; } int y=4; x;"
+.L.data.main.138:
+  .asciz "int x=2; { int x=3; } x;"
+.L.data.main.137:
+  .asciz "\042\134l\042[0]"
+.L.data.main.136:
+  .asciz "l"
+.L.data.main.135:
+  .asciz "\042\134k\042[0]"
+.L.data.main.134:
+  .asciz "k"
+.L.data.main.133:
+  .asciz "\042\134j\042[0]"
+.L.data.main.132:
+  .asciz "j"
+.L.data.main.131:
+  .asciz "\042\1340\042[0]"
+.L.data.main.129:
+  .asciz "\042\134e\042[0]"
+.L.data.main.128:
+  .asciz "\033"
+.L.data.main.127:
+  .asciz "\042\134r\042[0]"
+.L.data.main.126:
+  .asciz "\015"
+.L.data.main.125:
+  .asciz "\042\134f\042[0]"
+.L.data.main.124:
+  .asciz "\014"
+.L.data.main.123:
+  .asciz "\042\134v\042[0]"
+.L.data.main.122:
+  .asciz "\013"
+.L.data.main.121:
+  .asciz "\042\134n\042[0]"
+.L.data.main.120:
+  .asciz "\012"
+.L.data.main.119:
+  .asciz "\042\134t\042[0]"
+.L.data.main.118:
+  .asciz "\011"
+.L.data.main.117:
+  .asciz "\042\134b\042[0]"
+.L.data.main.116:
+  .asciz "\010"
+.L.data.main.115:
+  .asciz "\042\134a\042[0]"
+.L.data.main.114:
+  .asciz "\007"
+.L.data.main.113:
+  .asciz "sizeof(\042abc\042)"
+.L.data.main.112:
+  .asciz "abc"
+.L.data.main.111:
+  .asciz "\042abc\042[3]"
+.L.data.main.110:
+  .asciz "abc"
+.L.data.main.109:
+  .asciz "\042abc\042[2]"
+.L.data.main.108:
+  .asciz "abc"
+.L.data.main.107:
+  .asciz "\042abc\042[1]"
+.L.data.main.106:
+  .asciz "abc"
+.L.data.main.105:
+  .asciz "\042abc\042[0]"
+.L.data.main.104:
+  .asciz "abc"
+.L.data.main.103:
+  .asciz "sub_char(7, 3, 3)"
+.L.data.main.102:
+  .asciz "char x[10]; sizeof(x);"
+.L.data.main.101:
+  .asciz "char x; sizeof(x);"
+.L.data.main.100:
+  .asciz "char x=1; char y=2; y;"
+.L.data.main.99:
+  .asciz "char x=1; char y=2; x;"
+.L.data.main.98:
+  .asciz "char x=1; x;"
+.L.data.main.97:
+  .asciz "sizeof(g2)"
+.L.data.main.96:
+  .asciz "sizeof(g1)"
+.L.data.main.95:
+  .asciz "g2[3]"
+.L.data.main.94:
+  .asciz "g2[2]"
+.L.data.main.93:
+  .asciz "g2[1]"
+.L.data.main.92:
+  .asciz "g2[0]"
+.L.data.main.91:
+  .asciz "g1"
+.L.data.main.90:
+  .asciz "g1"
+.L.data.main.89:
+  .asciz "int x[3][4]; sizeof(**x + 1);"
+.L.data.main.88:
+  .asciz "int x[3][4]; sizeof **x + 1;"
+.L.data.main.87:
+  .asciz "int x[3][4]; sizeof(**x) + 1;"
+.L.data.main.86:
+  .asciz "int x[3][4]; sizeof(**x);"
+.L.data.main.85:
+  .asciz "int x[3][4]; sizeof(*x);"
+.L.data.main.84:
+  .asciz "int x[3][4]; sizeof(x);"
+.L.data.main.83:
+  .asciz "int x[4]; sizeof(x);"
+.L.data.main.82:
+  .asciz "int *x; sizeof(x);"
+.L.data.main.81:
+  .asciz "int x; sizeof x;"
+.L.data.main.80:
+  .asciz "int x; sizeof(x);"
+.L.data.main.79:
+  .asciz "int x[2][3]; int *y=x; y[6]=6; x[2][0];"
+.L.data.main.78:
+  .asciz "int x[2][3]; int *y=x; y[5]=5; x[1][2];"
+.L.data.main.77:
+  .asciz "int x[2][3]; int *y=x; y[4]=4; x[1][1];"
+.L.data.main.76:
+  .asciz "int x[2][3]; int *y=x; y[3]=3; x[1][0];"
+.L.data.main.75:
+  .asciz "int x[2][3]; int *y=x; y[2]=2; x[0][2];"
+.L.data.main.74:
+  .asciz "int x[2][3]; int *y=x; y[1]=1; x[0][1];"
+.L.data.main.73:
+  .asciz "int x[2][3]; int *y=x; y[0]=0; x[0][0];"
+.L.data.main.72:
+  .asciz "int x[3]; *x=3; x[1]=4; 2[x]=5; *(x+2);"
+.L.data.main.71:
+  .asciz "int x[3]; *x=3; x[1]=4; x[2]=5; *(x+2);"
+.L.data.main.70:
+  .asciz "int x[3]; *x=3; x[1]=4; x[2]=5; *(x+2);"
+.L.data.main.69:
+  .asciz "int x[3]; *x=3; x[1]=4; x[2]=5; *(x+1);"
+.L.data.main.68:
+  .asciz "int x[3]; *x=3; x[1]=4; x[2]=5; *x;"
+.L.data.main.67:
+  .asciz "int x[2][3]; int *y=x; *(y+6)=6; **(x+2);"
+.L.data.main.66:
+  .asciz "int x[2][3]; int *y=x; *(y+5)=5; *(*(x+1)+2);"
+.L.data.main.65:
+  .asciz "int x[2][3]; int *y=x; *(y+4)=4; *(*(x+1)+1);"
+.L.data.main.64:
+  .asciz "int x[2][3]; int *y=x; *(y+3)=3; **(x+1);"
+.L.data.main.63:
+  .asciz "int x[2][3]; int *y=x; *(y+2)=2; *(*x+2);"
+.L.data.main.62:
+  .asciz "int x[2][3]; int *y=x; *(y+1)=1; *(*x+1);"
+.L.data.main.61:
+  .asciz "int x[2][3]; int *y=x; *y=0; **x;"
+.L.data.main.60:
+  .asciz "int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *(x+2);"
+.L.data.main.59:
+  .asciz "int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *(x+1);"
+.L.data.main.58:
+  .asciz "int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *x;"
+.L.data.main.57:
+  .asciz "int x[2]; int *y=&x; *y=3; *x;"
+.L.data.main.56:
+  .asciz "int x=3; int y=5; addx(&x, y);"
+.L.data.main.55:
+  .asciz "int x=3; int y=5; *(&y-1)=7; x;"
+.L.data.main.54:
+  .asciz "int x=3; int y=5; *(&x+1)=7; y;"
+.L.data.main.53:
+  .asciz "int x=3; int *y=&x; *y=5; x;"
+.L.data.main.52:
+  .asciz "int x=3; int y=5; int *z=&y; *(z-1);"
+.L.data.main.51:
+  .asciz "int x=3; int y=5; int *z=&x; *(z+1);"
+.L.data.main.50:
+  .asciz "int x=3; int y=5; *(&y-1);"
+.L.data.main.49:
+  .asciz "int x=3; int y=5; *(1+&x);"
+.L.data.main.48:
+  .asciz "int x=3; int y=5; *(&x+1);"
+.L.data.main.47:
+  .asciz "int x=3; int *y=&x; int **z=&y; **z;"
+.L.data.main.46:
+  .asciz "int x=3; *&x;"
+.L.data.main.45:
+  .asciz "fib(9)"
+.L.data.main.44:
+  .asciz "add6(1,2,3,4,5,6)"
+.L.data.main.43:
+  .asciz "sub(5, 3)"
+.L.data.main.42:
+  .asciz "add(3, 5)"
+.L.data.main.41:
+  .asciz "int i=0; int j=0; for (i=0; i<=10; i=i+1) j=i+j; j;"
+.L.data.main.40:
+  .asciz "int i=0; int j=0; while(i<=10) {j=i+j; i=i+1;} j;"
+.L.data.main.39:
+  .asciz "int i=0; i=0; while(i<10) i=i+1; i;"
+.L.data.main.38:
+  .asciz "1; {2;} 3;"
+.L.data.main.37:
+  .asciz "int x=0; if (2-1) x=2; else x=3; x;"
+.L.data.main.36:
+  .asciz "int x=0; if (1) x=2; else x=3; x;"
+.L.data.main.35:
+  .asciz "int x=0; if (1-1) x=2; else x=3; x;"
+.L.data.main.34:
+  .asciz "int x=0; if (0) x=2; else x=3; x;"
+.L.data.main.33:
+  .asciz "ret3();"
+.L.data.main.32:
+  .asciz "int foo123=3; int bar=5; foo123+bar;"
+.L.data.main.31:
+  .asciz "int foo=3; foo;"
+.L.data.main.30:
+  .asciz "int a=3; int z=5; a+z;"
+.L.data.main.29:
+  .asciz "int a=3; a;"
+.L.data.main.28:
+  .asciz "int a; int z; a=3; z=5; a+z;"
+.L.data.main.27:
+  .asciz "int a; a=3; a;"
+.L.data.main.26:
+  .asciz "1>=2"
+.L.data.main.25:
+  .asciz "1>=1"
+.L.data.main.24:
+  .asciz "1>=0"
+.L.data.main.23:
+  .asciz "1>2"
+.L.data.main.22:
+  .asciz "1>1"
+.L.data.main.21:
+  .asciz "1>0"
+.L.data.main.20:
+  .asciz "2<=1"
+.L.data.main.19:
+  .asciz "1<=1"
+.L.data.main.18:
+  .asciz "0<=1"
+.L.data.main.17:
+  .asciz "2<1"
+.L.data.main.16:
+  .asciz "1<1"
+.L.data.main.15:
+  .asciz "0<1"
+.L.data.main.14:
+  .asciz "42!=42"
+.L.data.main.13:
+  .asciz "0!=1"
+.L.data.main.12:
+  .asciz "42==42"
+.L.data.main.11:
+  .asciz "0==1"
+.L.data.main.10:
+  .asciz "- - +10"
+.L.data.main.9:
+  .asciz "- -10"
+.L.data.main.8:
+  .asciz "0"
+.L.data.main.7:
+  .asciz "(3+5)/2"
+.L.data.main.6:
+  .asciz "5*(9-6)"
+.L.data.main.5:
+  .asciz "0"
+.L.data.main.4:
+  .asciz " 12 + 34 - 5 "
+.L.data.main.3:
+  .asciz "0"
+.L.data.main.2:
+  .asciz "42"
+.L.data.main.1:
+  .asciz "0"
+.L.data.main.0:
+  .asciz "int a=3; int z=5; a+z;"
+.L.data.assert.1:
+  .asciz "%s => %ld expected but got %ld\012"
+.L.data.assert.0:
+  .asciz "%s => %ld\012"
+.L.data.2:
+  .asciz "bar"
+.L.data.1:
+  .asciz "foo"
+.L.data.0:
+  .asciz "abc"
+.bss
+  .type .L.data.count.0, @object
+  .size .L.data.count.0, 4
+  .align 4
+.L.data.count.0:
+  .zero 4
+  .type g2, @object
+  .size g2, 16
+  .align 4
+g2:
+  .zero 16
+  .type g1, @object
+  .size g1, 4
+  .align 4
+g1:
+  .zero 4
+.text
+.globl assert
+assert:
+# prologue
+  push rbp
+  mov rbp, rsp
+  sub rsp, 24
+  mov [rbp-24], rdi
+  mov [rbp-16], rsi
+  mov [rbp-8], rdx
+# program body
+  mov rax, rbp
+  sub rax, 24
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 16
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  sete al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je  .Lelse.assert.1
+  push offset .L.data.assert.0
+  mov rax, rbp
+  sub rax, 8
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 16
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.assert.2
+  mov rax, 0
+  call printf
+  jmp .Lend.assert.2
+.Lcall.assert.2:
+  sub rsp, 8
+  mov rax, 0
+  call printf
+  add rsp, 8
+.Lend.assert.2:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  jmp  .Lend.assert.1
+.Lelse.assert.1:
+  push offset .L.data.assert.1
+  mov rax, rbp
+  sub rax, 8
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 24
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 16
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rcx
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.assert.3
+  mov rax, 0
+  call printf
+  jmp .Lend.assert.3
+.Lcall.assert.3:
+  sub rsp, 8
+  mov rax, 0
+  call printf
+  add rsp, 8
+.Lend.assert.3:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.assert.4
+  mov rax, 0
+  call exit
+  jmp .Lend.assert.4
+.Lcall.assert.4:
+  sub rsp, 8
+  mov rax, 0
+  call exit
+  add rsp, 8
+.Lend.assert.4:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+.Lend.assert.1:
+# epilogue
+.Lreturn.assert:
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl ret3
+ret3:
+# prologue
+  push rbp
+  mov rbp, rsp
+  sub rsp, 0
+# program body
+  push 3
+  pop rax
+  jmp .Lreturn.ret3
+  push 5
+  pop rax
+  jmp .Lreturn.ret3
+# epilogue
+.Lreturn.ret3:
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl add2
+add2:
+# prologue
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  mov [rbp-8], edi
+  mov [rbp-4], esi
+# program body
+  mov rax, rbp
+  sub rax, 8
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 4
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rax
+  jmp .Lreturn.add2
+# epilogue
+.Lreturn.add2:
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl sub2
+sub2:
+# prologue
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  mov [rbp-8], edi
+  mov [rbp-4], esi
+# program body
+  mov rax, rbp
+  sub rax, 8
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 4
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rax
+  jmp .Lreturn.sub2
+# epilogue
+.Lreturn.sub2:
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl add6
+add6:
+# prologue
+  push rbp
+  mov rbp, rsp
+  sub rsp, 24
+  mov [rbp-24], edi
+  mov [rbp-20], esi
+  mov [rbp-16], edx
+  mov [rbp-12], ecx
+  mov [rbp-8], r8d
+  mov [rbp-4], r9d
+# program body
+  mov rax, rbp
+  sub rax, 24
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 20
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 16
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 12
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 8
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 4
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rax
+  jmp .Lreturn.add6
+# epilogue
+.Lreturn.add6:
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl addx
+addx:
+# prologue
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-16], rdi
+  mov [rbp-4], esi
+# program body
+  mov rax, rbp
+  sub rax, 16
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 4
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rax
+  jmp .Lreturn.addx
+# epilogue
+.Lreturn.addx:
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl sub_char
+sub_char:
+# prologue
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  mov [rbp-3], dil
+  mov [rbp-2], sil
+  mov [rbp-1], dl
+# program body
+  mov rax, rbp
+  sub rax, 3
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 2
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 1
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rax
+  jmp .Lreturn.sub_char
+# epilogue
+.Lreturn.sub_char:
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl sub_short
+sub_short:
+# prologue
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  mov [rbp-6], di
+  mov [rbp-4], si
+  mov [rbp-2], dx
+# program body
+  mov rax, rbp
+  sub rax, 6
+  push rax
+  pop rax
+  movsx rax, word ptr [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 4
+  push rax
+  pop rax
+  movsx rax, word ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 2
+  push rax
+  pop rax
+  movsx rax, word ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rax
+  jmp .Lreturn.sub_short
+# epilogue
+.Lreturn.sub_short:
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl sub_long
+sub_long:
+# prologue
+  push rbp
+  mov rbp, rsp
+  sub rsp, 24
+  mov [rbp-24], rdi
+  mov [rbp-16], rsi
+  mov [rbp-8], rdx
+# program body
+  mov rax, rbp
+  sub rax, 24
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 16
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 8
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rax
+  jmp .Lreturn.sub_long
+# epilogue
+.Lreturn.sub_long:
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl g1_ptr
+g1_ptr:
+# prologue
+  push rbp
+  mov rbp, rsp
+  sub rsp, 0
+# program body
+  push offset g1
+  pop rax
+  jmp .Lreturn.g1_ptr
+# epilogue
+.Lreturn.g1_ptr:
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl fib
+fib:
+# prologue
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  mov [rbp-4], edi
+# program body
+  mov rax, rbp
+  sub rax, 4
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setle al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je  .Lend.fib.1
+  push 1
+  pop rax
+  jmp .Lreturn.fib
+.Lend.fib.1:
+  mov rax, rbp
+  sub rax, 4
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.fib.2
+  mov rax, 0
+  call fib
+  jmp .Lend.fib.2
+.Lcall.fib.2:
+  sub rsp, 8
+  mov rax, 0
+  call fib
+  add rsp, 8
+.Lend.fib.2:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  mov rax, rbp
+  sub rax, 4
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.fib.3
+  mov rax, 0
+  call fib
+  jmp .Lend.fib.3
+.Lcall.fib.3:
+  sub rsp, 8
+  mov rax, 0
+  call fib
+  add rsp, 8
+.Lend.fib.3:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rax
+  jmp .Lreturn.fib
+# epilogue
+.Lreturn.fib:
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl count
+count:
+# prologue
+  push rbp
+  mov rbp, rsp
+  sub rsp, 0
+# program body
+  push offset .L.data.count.0
+  push offset .L.data.count.0
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  push offset .L.data.count.0
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  jmp .Lreturn.count
+# epilogue
+.Lreturn.count:
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl param_decay
+param_decay:
+# prologue
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  mov [rbp-8], rdi
+# program body
+  mov rax, rbp
+  sub rax, 8
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  jmp .Lreturn.param_decay
+# epilogue
+.Lreturn.param_decay:
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl voidfn
+voidfn:
+# prologue
+  push rbp
+  mov rbp, rsp
+  sub rsp, 0
+# program body
+# epilogue
+.Lreturn.voidfn:
+  mov rsp, rbp
+  pop rbp
+  ret
+.globl main
+main:
+# prologue
+  push rbp
+  mov rbp, rsp
+  sub rsp, 2808
+# program body
+  push 8
+  mov rax, rbp
+  sub rax, 2808
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2804
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2808
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 2804
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  push offset .L.data.main.0
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.1
+  mov rax, 0
+  call assert
+  jmp .Lend.main.1
+.Lcall.main.1:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.1:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push 0
+  push offset .L.data.main.1
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.2
+  mov rax, 0
+  call assert
+  jmp .Lend.main.2
+.Lcall.main.2:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.2:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 42
+  push 42
+  push offset .L.data.main.2
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.3
+  mov rax, 0
+  call assert
+  jmp .Lend.main.3
+.Lcall.main.3:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.3:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 5
+  push 5
+  push offset .L.data.main.3
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.4
+  mov rax, 0
+  call assert
+  jmp .Lend.main.4
+.Lcall.main.4:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.4:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 41
+  push 12
+  push 34
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  push offset .L.data.main.4
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.5
+  mov rax, 0
+  call assert
+  jmp .Lend.main.5
+.Lcall.main.5:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.5:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 5
+  push 5
+  push offset .L.data.main.5
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.6
+  mov rax, 0
+  call assert
+  jmp .Lend.main.6
+.Lcall.main.6:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.6:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 15
+  push 5
+  push 9
+  push 6
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  imul rax, rdi
+  push rax
+  push offset .L.data.main.6
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.7
+  mov rax, 0
+  call assert
+  jmp .Lend.main.7
+.Lcall.main.7:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.7:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  push 3
+  push 5
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  cqo
+  idiv rdi
+  push rax
+  push offset .L.data.main.7
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.8
+  mov rax, 0
+  call assert
+  jmp .Lend.main.8
+.Lcall.main.8:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.8:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push 10
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  push 0
+  push 10
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  push offset .L.data.main.8
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.9
+  mov rax, 0
+  call assert
+  jmp .Lend.main.9
+.Lcall.main.9:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.9:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 10
+  push 0
+  push 0
+  push 10
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  push offset .L.data.main.9
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.10
+  mov rax, 0
+  call assert
+  jmp .Lend.main.10
+.Lcall.main.10:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.10:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 10
+  push 0
+  push 0
+  push 10
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  push offset .L.data.main.10
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.11
+  mov rax, 0
+  call assert
+  jmp .Lend.main.11
+.Lcall.main.11:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.11:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  sete al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.11
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.12
+  mov rax, 0
+  call assert
+  jmp .Lend.main.12
+.Lcall.main.12:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.12:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  push 42
+  push 42
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  sete al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.12
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.13
+  mov rax, 0
+  call assert
+  jmp .Lend.main.13
+.Lcall.main.13:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.13:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setne al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.13
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.14
+  mov rax, 0
+  call assert
+  jmp .Lend.main.14
+.Lcall.main.14:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.14:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push 42
+  push 42
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setne al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.14
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.15
+  mov rax, 0
+  call assert
+  jmp .Lend.main.15
+.Lcall.main.15:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.15:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.15
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.16
+  mov rax, 0
+  call assert
+  jmp .Lend.main.16
+.Lcall.main.16:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.16:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push 1
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.16
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.17
+  mov rax, 0
+  call assert
+  jmp .Lend.main.17
+.Lcall.main.17:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.17:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push 2
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.17
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.18
+  mov rax, 0
+  call assert
+  jmp .Lend.main.18
+.Lcall.main.18:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.18:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setle al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.18
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.19
+  mov rax, 0
+  call assert
+  jmp .Lend.main.19
+.Lcall.main.19:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.19:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  push 1
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setle al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.19
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.20
+  mov rax, 0
+  call assert
+  jmp .Lend.main.20
+.Lcall.main.20:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.20:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push 2
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setle al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.20
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.21
+  mov rax, 0
+  call assert
+  jmp .Lend.main.21
+.Lcall.main.21:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.21:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.21
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.22
+  mov rax, 0
+  call assert
+  jmp .Lend.main.22
+.Lcall.main.22:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.22:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push 1
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.22
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.23
+  mov rax, 0
+  call assert
+  jmp .Lend.main.23
+.Lcall.main.23:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.23:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push 2
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.23
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.24
+  mov rax, 0
+  call assert
+  jmp .Lend.main.24
+.Lcall.main.24:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.24:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setle al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.24
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.25
+  mov rax, 0
+  call assert
+  jmp .Lend.main.25
+.Lcall.main.25:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.25:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  push 1
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setle al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.25
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.26
+  mov rax, 0
+  call assert
+  jmp .Lend.main.26
+.Lcall.main.26:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.26:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push 2
+  push 1
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setle al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.26
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.27
+  mov rax, 0
+  call assert
+  jmp .Lend.main.27
+.Lcall.main.27:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.27:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 2800
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2800
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.27
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.28
+  mov rax, 0
+  call assert
+  jmp .Lend.main.28
+.Lcall.main.28:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.28:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 8
+  mov rax, rbp
+  sub rax, 2796
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2792
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2796
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 2792
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  push offset .L.data.main.28
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.29
+  mov rax, 0
+  call assert
+  jmp .Lend.main.29
+.Lcall.main.29:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.29:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 2788
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2788
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.29
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.30
+  mov rax, 0
+  call assert
+  jmp .Lend.main.30
+.Lcall.main.30:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.30:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 8
+  mov rax, rbp
+  sub rax, 2784
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2780
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2784
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 2780
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  push offset .L.data.main.30
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.31
+  mov rax, 0
+  call assert
+  jmp .Lend.main.31
+.Lcall.main.31:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.31:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 2776
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2776
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.31
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.32
+  mov rax, 0
+  call assert
+  jmp .Lend.main.32
+.Lcall.main.32:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.32:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 8
+  mov rax, rbp
+  sub rax, 2772
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2768
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2772
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 2768
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  push offset .L.data.main.32
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.33
+  mov rax, 0
+  call assert
+  jmp .Lend.main.33
+.Lcall.main.33:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.33:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.34
+  mov rax, 0
+  call ret3
+  jmp .Lend.main.34
+.Lcall.main.34:
+  sub rsp, 8
+  mov rax, 0
+  call ret3
+  add rsp, 8
+.Lend.main.34:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  push offset .L.data.main.33
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.35
+  mov rax, 0
+  call assert
+  jmp .Lend.main.35
+.Lcall.main.35:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.35:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 2764
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rax
+  cmp rax, 0
+  je  .Lelse.main.36
+  mov rax, rbp
+  sub rax, 2764
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp  .Lend.main.36
+.Lelse.main.36:
+  mov rax, rbp
+  sub rax, 2764
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.Lend.main.36:
+  mov rax, rbp
+  sub rax, 2764
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.34
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.37
+  mov rax, 0
+  call assert
+  jmp .Lend.main.37
+.Lcall.main.37:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.37:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 2760
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  push 1
+  push 1
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rax
+  cmp rax, 0
+  je  .Lelse.main.38
+  mov rax, rbp
+  sub rax, 2760
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp  .Lend.main.38
+.Lelse.main.38:
+  mov rax, rbp
+  sub rax, 2760
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.Lend.main.38:
+  mov rax, rbp
+  sub rax, 2760
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.35
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.39
+  mov rax, 0
+  call assert
+  jmp .Lend.main.39
+.Lcall.main.39:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.39:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  mov rax, rbp
+  sub rax, 2756
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  push 1
+  pop rax
+  cmp rax, 0
+  je  .Lelse.main.40
+  mov rax, rbp
+  sub rax, 2756
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp  .Lend.main.40
+.Lelse.main.40:
+  mov rax, rbp
+  sub rax, 2756
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.Lend.main.40:
+  mov rax, rbp
+  sub rax, 2756
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.36
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.41
+  mov rax, 0
+  call assert
+  jmp .Lend.main.41
+.Lcall.main.41:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.41:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  mov rax, rbp
+  sub rax, 2752
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  push 2
+  push 1
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rax
+  cmp rax, 0
+  je  .Lelse.main.42
+  mov rax, rbp
+  sub rax, 2752
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp  .Lend.main.42
+.Lelse.main.42:
+  mov rax, rbp
+  sub rax, 2752
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.Lend.main.42:
+  mov rax, rbp
+  sub rax, 2752
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.37
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.43
+  mov rax, 0
+  call assert
+  jmp .Lend.main.43
+.Lcall.main.43:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.43:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  push 1
+  add rsp, 8
+  push 2
+  add rsp, 8
+  push 3
+  push offset .L.data.main.38
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.44
+  mov rax, 0
+  call assert
+  jmp .Lend.main.44
+.Lcall.main.44:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.44:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 10
+  mov rax, rbp
+  sub rax, 2748
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2748
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.L.continue.main.45:
+  mov rax, rbp
+  sub rax, 2748
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je  .L.break.main.45
+  mov rax, rbp
+  sub rax, 2748
+  push rax
+  mov rax, rbp
+  sub rax, 2748
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp .L.continue.main.45
+.L.break.main.45:
+  mov rax, rbp
+  sub rax, 2748
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.39
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.46
+  mov rax, 0
+  call assert
+  jmp .Lend.main.46
+.Lcall.main.46:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.46:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 55
+  mov rax, rbp
+  sub rax, 2744
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2740
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.L.continue.main.47:
+  mov rax, rbp
+  sub rax, 2744
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setle al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je  .L.break.main.47
+  mov rax, rbp
+  sub rax, 2740
+  push rax
+  mov rax, rbp
+  sub rax, 2744
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 2740
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2744
+  push rax
+  mov rax, rbp
+  sub rax, 2744
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp .L.continue.main.47
+.L.break.main.47:
+  mov rax, rbp
+  sub rax, 2740
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.40
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.48
+  mov rax, 0
+  call assert
+  jmp .Lend.main.48
+.Lcall.main.48:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.48:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 55
+  mov rax, rbp
+  sub rax, 2736
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2732
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2736
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.Lbegin.main.49:
+  mov rax, rbp
+  sub rax, 2736
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setle al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je  .L.break.main.49
+  mov rax, rbp
+  sub rax, 2732
+  push rax
+  mov rax, rbp
+  sub rax, 2736
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 2732
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.L.continue.main.49:
+  mov rax, rbp
+  sub rax, 2736
+  push rax
+  mov rax, rbp
+  sub rax, 2736
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp  .Lbegin.main.49
+.L.break.main.49:
+  mov rax, rbp
+  sub rax, 2732
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.41
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.50
+  mov rax, 0
+  call assert
+  jmp .Lend.main.50
+.Lcall.main.50:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.50:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 8
+  push 3
+  push 5
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.51
+  mov rax, 0
+  call add2
+  jmp .Lend.main.51
+.Lcall.main.51:
+  sub rsp, 8
+  mov rax, 0
+  call add2
+  add rsp, 8
+.Lend.main.51:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  push offset .L.data.main.42
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.52
+  mov rax, 0
+  call assert
+  jmp .Lend.main.52
+.Lcall.main.52:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.52:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  push 5
+  push 3
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.53
+  mov rax, 0
+  call sub2
+  jmp .Lend.main.53
+.Lcall.main.53:
+  sub rsp, 8
+  mov rax, 0
+  call sub2
+  add rsp, 8
+.Lend.main.53:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  push offset .L.data.main.43
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.54
+  mov rax, 0
+  call assert
+  jmp .Lend.main.54
+.Lcall.main.54:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.54:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 21
+  push 1
+  push 2
+  push 3
+  push 4
+  push 5
+  push 6
+  pop r9
+  pop r8
+  pop rcx
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.55
+  mov rax, 0
+  call add6
+  jmp .Lend.main.55
+.Lcall.main.55:
+  sub rsp, 8
+  mov rax, 0
+  call add6
+  add rsp, 8
+.Lend.main.55:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  push offset .L.data.main.44
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.56
+  mov rax, 0
+  call assert
+  jmp .Lend.main.56
+.Lcall.main.56:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.56:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 55
+  push 9
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.57
+  mov rax, 0
+  call fib
+  jmp .Lend.main.57
+.Lcall.main.57:
+  sub rsp, 8
+  mov rax, 0
+  call fib
+  add rsp, 8
+.Lend.main.57:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  push offset .L.data.main.45
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.58
+  mov rax, 0
+  call assert
+  jmp .Lend.main.58
+.Lcall.main.58:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.58:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 2728
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2728
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.46
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.59
+  mov rax, 0
+  call assert
+  jmp .Lend.main.59
+.Lcall.main.59:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.59:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 2724
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2720
+  push rax
+  mov rax, rbp
+  sub rax, 2724
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2712
+  push rax
+  mov rax, rbp
+  sub rax, 2720
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2712
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.47
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.60
+  mov rax, 0
+  call assert
+  jmp .Lend.main.60
+.Lcall.main.60:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.60:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 5
+  mov rax, rbp
+  sub rax, 2704
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2700
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2704
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.48
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.61
+  mov rax, 0
+  call assert
+  jmp .Lend.main.61
+.Lcall.main.61:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.61:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 5
+  mov rax, rbp
+  sub rax, 2696
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2692
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2696
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.49
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.62
+  mov rax, 0
+  call assert
+  jmp .Lend.main.62
+.Lcall.main.62:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.62:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 2688
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2684
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2684
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  sub rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.50
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.63
+  mov rax, 0
+  call assert
+  jmp .Lend.main.63
+.Lcall.main.63:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.63:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 5
+  mov rax, rbp
+  sub rax, 2680
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2676
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2672
+  push rax
+  mov rax, rbp
+  sub rax, 2680
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2672
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.51
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.64
+  mov rax, 0
+  call assert
+  jmp .Lend.main.64
+.Lcall.main.64:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.64:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 2664
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2660
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2656
+  push rax
+  mov rax, rbp
+  sub rax, 2660
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2656
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  sub rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.52
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.65
+  mov rax, 0
+  call assert
+  jmp .Lend.main.65
+.Lcall.main.65:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.65:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 5
+  mov rax, rbp
+  sub rax, 2644
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2640
+  push rax
+  mov rax, rbp
+  sub rax, 2644
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2640
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2644
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.53
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.66
+  mov rax, 0
+  call assert
+  jmp .Lend.main.66
+.Lcall.main.66:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.66:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 7
+  mov rax, rbp
+  sub rax, 2632
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2628
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2632
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 7
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2628
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.54
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.67
+  mov rax, 0
+  call assert
+  jmp .Lend.main.67
+.Lcall.main.67:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.67:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 7
+  mov rax, rbp
+  sub rax, 2624
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2620
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2620
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  sub rax, rdi
+  push rax
+  push 7
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2624
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.55
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.68
+  mov rax, 0
+  call assert
+  jmp .Lend.main.68
+.Lcall.main.68:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.68:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 8
+  mov rax, rbp
+  sub rax, 2616
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2612
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2616
+  push rax
+  mov rax, rbp
+  sub rax, 2612
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.69
+  mov rax, 0
+  call addx
+  jmp .Lend.main.69
+.Lcall.main.69:
+  sub rsp, 8
+  mov rax, 0
+  call addx
+  add rsp, 8
+.Lend.main.69:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  push offset .L.data.main.56
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.70
+  mov rax, 0
+  call assert
+  jmp .Lend.main.70
+.Lcall.main.70:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.70:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 2600
+  push rax
+  mov rax, rbp
+  sub rax, 2608
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2600
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2608
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.57
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.71
+  mov rax, 0
+  call assert
+  jmp .Lend.main.71
+.Lcall.main.71:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.71:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 2588
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2588
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2588
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2588
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.58
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.72
+  mov rax, 0
+  call assert
+  jmp .Lend.main.72
+.Lcall.main.72:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.72:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  mov rax, rbp
+  sub rax, 2576
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2576
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2576
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2576
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.59
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.73
+  mov rax, 0
+  call assert
+  jmp .Lend.main.73
+.Lcall.main.73:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.73:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 5
+  mov rax, rbp
+  sub rax, 2564
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2564
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2564
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2564
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.60
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.74
+  mov rax, 0
+  call assert
+  jmp .Lend.main.74
+.Lcall.main.74:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.74:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  mov rax, rbp
+  sub rax, 2528
+  push rax
+  mov rax, rbp
+  sub rax, 2552
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2528
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2552
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.61
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.75
+  mov rax, 0
+  call assert
+  jmp .Lend.main.75
+.Lcall.main.75:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.75:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 2496
+  push rax
+  mov rax, rbp
+  sub rax, 2520
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2496
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2520
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.62
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.76
+  mov rax, 0
+  call assert
+  jmp .Lend.main.76
+.Lcall.main.76:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.76:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  mov rax, rbp
+  sub rax, 2464
+  push rax
+  mov rax, rbp
+  sub rax, 2488
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2464
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2488
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.63
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.77
+  mov rax, 0
+  call assert
+  jmp .Lend.main.77
+.Lcall.main.77:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.77:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 2432
+  push rax
+  mov rax, rbp
+  sub rax, 2456
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2432
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2456
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.64
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.78
+  mov rax, 0
+  call assert
+  jmp .Lend.main.78
+.Lcall.main.78:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.78:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  mov rax, rbp
+  sub rax, 2400
+  push rax
+  mov rax, rbp
+  sub rax, 2424
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2400
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2424
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.65
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.79
+  mov rax, 0
+  call assert
+  jmp .Lend.main.79
+.Lcall.main.79:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.79:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 5
+  mov rax, rbp
+  sub rax, 2368
+  push rax
+  mov rax, rbp
+  sub rax, 2392
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2368
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2392
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.66
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.80
+  mov rax, 0
+  call assert
+  jmp .Lend.main.80
+.Lcall.main.80:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.80:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 6
+  mov rax, rbp
+  sub rax, 2336
+  push rax
+  mov rax, rbp
+  sub rax, 2360
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2336
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 6
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 6
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2360
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.67
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.81
+  mov rax, 0
+  call assert
+  jmp .Lend.main.81
+.Lcall.main.81:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.81:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 2324
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2324
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2324
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2324
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.68
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.82
+  mov rax, 0
+  call assert
+  jmp .Lend.main.82
+.Lcall.main.82:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.82:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  mov rax, rbp
+  sub rax, 2312
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2312
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2312
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2312
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.69
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.83
+  mov rax, 0
+  call assert
+  jmp .Lend.main.83
+.Lcall.main.83:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.83:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 5
+  mov rax, rbp
+  sub rax, 2300
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2300
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2300
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2300
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.70
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.84
+  mov rax, 0
+  call assert
+  jmp .Lend.main.84
+.Lcall.main.84:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.84:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 5
+  mov rax, rbp
+  sub rax, 2288
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2288
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2288
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2288
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.71
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.85
+  mov rax, 0
+  call assert
+  jmp .Lend.main.85
+.Lcall.main.85:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.85:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 5
+  mov rax, rbp
+  sub rax, 2276
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2276
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2276
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2276
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.72
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.86
+  mov rax, 0
+  call assert
+  jmp .Lend.main.86
+.Lcall.main.86:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.86:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  mov rax, rbp
+  sub rax, 2240
+  push rax
+  mov rax, rbp
+  sub rax, 2264
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2240
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2264
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.73
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.87
+  mov rax, 0
+  call assert
+  jmp .Lend.main.87
+.Lcall.main.87:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.87:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 2208
+  push rax
+  mov rax, rbp
+  sub rax, 2232
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2208
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2232
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.74
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.88
+  mov rax, 0
+  call assert
+  jmp .Lend.main.88
+.Lcall.main.88:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.88:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  mov rax, rbp
+  sub rax, 2176
+  push rax
+  mov rax, rbp
+  sub rax, 2200
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2176
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2200
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.75
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.89
+  mov rax, 0
+  call assert
+  jmp .Lend.main.89
+.Lcall.main.89:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.89:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 2144
+  push rax
+  mov rax, rbp
+  sub rax, 2168
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2144
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2168
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.76
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.90
+  mov rax, 0
+  call assert
+  jmp .Lend.main.90
+.Lcall.main.90:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.90:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  mov rax, rbp
+  sub rax, 2112
+  push rax
+  mov rax, rbp
+  sub rax, 2136
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2112
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2136
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.77
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.91
+  mov rax, 0
+  call assert
+  jmp .Lend.main.91
+.Lcall.main.91:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.91:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 5
+  mov rax, rbp
+  sub rax, 2080
+  push rax
+  mov rax, rbp
+  sub rax, 2104
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2080
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2104
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.78
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.92
+  mov rax, 0
+  call assert
+  jmp .Lend.main.92
+.Lcall.main.92:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.92:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 6
+  mov rax, rbp
+  sub rax, 2048
+  push rax
+  mov rax, rbp
+  sub rax, 2072
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2048
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 6
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 6
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2072
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.79
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.93
+  mov rax, 0
+  call assert
+  jmp .Lend.main.93
+.Lcall.main.93:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.93:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  push 4
+  push offset .L.data.main.80
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.94
+  mov rax, 0
+  call assert
+  jmp .Lend.main.94
+.Lcall.main.94:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.94:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  push 4
+  push offset .L.data.main.81
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.95
+  mov rax, 0
+  call assert
+  jmp .Lend.main.95
+.Lcall.main.95:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.95:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  push offset .L.data.main.82
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.96
+  mov rax, 0
+  call assert
+  jmp .Lend.main.96
+.Lcall.main.96:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.96:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 16
+  push 16
+  push offset .L.data.main.83
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.97
+  mov rax, 0
+  call assert
+  jmp .Lend.main.97
+.Lcall.main.97:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.97:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 48
+  push 48
+  push offset .L.data.main.84
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.98
+  mov rax, 0
+  call assert
+  jmp .Lend.main.98
+.Lcall.main.98:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.98:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 16
+  push 16
+  push offset .L.data.main.85
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.99
+  mov rax, 0
+  call assert
+  jmp .Lend.main.99
+.Lcall.main.99:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.99:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  push 4
+  push offset .L.data.main.86
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.100
+  mov rax, 0
+  call assert
+  jmp .Lend.main.100
+.Lcall.main.100:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.100:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 5
+  push 4
+  push 1
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  push offset .L.data.main.87
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.101
+  mov rax, 0
+  call assert
+  jmp .Lend.main.101
+.Lcall.main.101:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.101:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 5
+  push 4
+  push 1
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  push offset .L.data.main.88
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.102
+  mov rax, 0
+  call assert
+  jmp .Lend.main.102
+.Lcall.main.102:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.102:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  push 4
+  push offset .L.data.main.89
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.103
+  mov rax, 0
+  call assert
+  jmp .Lend.main.103
+.Lcall.main.103:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.103:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push offset g1
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.90
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.104
+  mov rax, 0
+  call assert
+  jmp .Lend.main.104
+.Lcall.main.104:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.104:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push offset g1
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  push 3
+  push offset g1
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.91
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.105
+  mov rax, 0
+  call assert
+  jmp .Lend.main.105
+.Lcall.main.105:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.105:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push offset g2
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  push offset g2
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  push offset g2
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  push offset g2
+  push 3
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  push 0
+  push offset g2
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.92
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.106
+  mov rax, 0
+  call assert
+  jmp .Lend.main.106
+.Lcall.main.106:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.106:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  push offset g2
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.93
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.107
+  mov rax, 0
+  call assert
+  jmp .Lend.main.107
+.Lcall.main.107:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.107:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  push offset g2
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.94
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.108
+  mov rax, 0
+  call assert
+  jmp .Lend.main.108
+.Lcall.main.108:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.108:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  push offset g2
+  push 3
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.95
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.109
+  mov rax, 0
+  call assert
+  jmp .Lend.main.109
+.Lcall.main.109:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.109:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  push 4
+  push offset .L.data.main.96
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.110
+  mov rax, 0
+  call assert
+  jmp .Lend.main.110
+.Lcall.main.110:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.110:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 16
+  push 16
+  push offset .L.data.main.97
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.111
+  mov rax, 0
+  call assert
+  jmp .Lend.main.111
+.Lcall.main.111:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.111:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 1716
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1716
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.98
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.112
+  mov rax, 0
+  call assert
+  jmp .Lend.main.112
+.Lcall.main.112:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.112:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 1715
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1714
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1715
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.99
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.113
+  mov rax, 0
+  call assert
+  jmp .Lend.main.113
+.Lcall.main.113:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.113:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  mov rax, rbp
+  sub rax, 1713
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1712
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1712
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.100
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.114
+  mov rax, 0
+  call assert
+  jmp .Lend.main.114
+.Lcall.main.114:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.114:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  push 1
+  push offset .L.data.main.101
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.115
+  mov rax, 0
+  call assert
+  jmp .Lend.main.115
+.Lcall.main.115:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.115:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 10
+  push 10
+  push offset .L.data.main.102
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.116
+  mov rax, 0
+  call assert
+  jmp .Lend.main.116
+.Lcall.main.116:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.116:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  push 7
+  push 3
+  push 3
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.117
+  mov rax, 0
+  call sub_char
+  jmp .Lend.main.117
+.Lcall.main.117:
+  sub rsp, 8
+  mov rax, 0
+  call sub_char
+  add rsp, 8
+.Lend.main.117:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  push offset .L.data.main.103
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.118
+  mov rax, 0
+  call assert
+  jmp .Lend.main.118
+.Lcall.main.118:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.118:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 97
+  push offset .L.data.main.104
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.105
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.119
+  mov rax, 0
+  call assert
+  jmp .Lend.main.119
+.Lcall.main.119:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.119:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 98
+  push offset .L.data.main.106
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.107
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.120
+  mov rax, 0
+  call assert
+  jmp .Lend.main.120
+.Lcall.main.120:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.120:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 99
+  push offset .L.data.main.108
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.109
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.121
+  mov rax, 0
+  call assert
+  jmp .Lend.main.121
+.Lcall.main.121:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.121:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push offset .L.data.main.110
+  push 3
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.111
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.122
+  mov rax, 0
+  call assert
+  jmp .Lend.main.122
+.Lcall.main.122:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.122:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  push 4
+  push offset .L.data.main.113
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.123
+  mov rax, 0
+  call assert
+  jmp .Lend.main.123
+.Lcall.main.123:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.123:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 7
+  push offset .L.data.main.114
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.115
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.124
+  mov rax, 0
+  call assert
+  jmp .Lend.main.124
+.Lcall.main.124:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.124:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 8
+  push offset .L.data.main.116
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.117
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.125
+  mov rax, 0
+  call assert
+  jmp .Lend.main.125
+.Lcall.main.125:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.125:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 9
+  push offset .L.data.main.118
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.119
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.126
+  mov rax, 0
+  call assert
+  jmp .Lend.main.126
+.Lcall.main.126:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.126:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 10
+  push offset .L.data.main.120
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.121
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.127
+  mov rax, 0
+  call assert
+  jmp .Lend.main.127
+.Lcall.main.127:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.127:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 11
+  push offset .L.data.main.122
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.123
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.128
+  mov rax, 0
+  call assert
+  jmp .Lend.main.128
+.Lcall.main.128:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.128:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 12
+  push offset .L.data.main.124
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.125
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.129
+  mov rax, 0
+  call assert
+  jmp .Lend.main.129
+.Lcall.main.129:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.129:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 13
+  push offset .L.data.main.126
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.127
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.130
+  mov rax, 0
+  call assert
+  jmp .Lend.main.130
+.Lcall.main.130:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.130:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 27
+  push offset .L.data.main.128
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.129
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.131
+  mov rax, 0
+  call assert
+  jmp .Lend.main.131
+.Lcall.main.131:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.131:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push offset .L.data.main.130
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.131
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.132
+  mov rax, 0
+  call assert
+  jmp .Lend.main.132
+.Lcall.main.132:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.132:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 106
+  push offset .L.data.main.132
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.133
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.133
+  mov rax, 0
+  call assert
+  jmp .Lend.main.133
+.Lcall.main.133:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.133:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 107
+  push offset .L.data.main.134
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.135
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.134
+  mov rax, 0
+  call assert
+  jmp .Lend.main.134
+.Lcall.main.134:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.134:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 108
+  push offset .L.data.main.136
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.137
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.135
+  mov rax, 0
+  call assert
+  jmp .Lend.main.135
+.Lcall.main.135:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.135:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  mov rax, rbp
+  sub rax, 1700
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1696
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1700
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.138
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.136
+  mov rax, 0
+  call assert
+  jmp .Lend.main.136
+.Lcall.main.136:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.136:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  mov rax, rbp
+  sub rax, 1692
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1688
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1684
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1692
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.139
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.137
+  mov rax, 0
+  call assert
+  jmp .Lend.main.137
+.Lcall.main.137:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.137:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 1680
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1680
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1680
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.140
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.138
+  mov rax, 0
+  call assert
+  jmp .Lend.main.138
+.Lcall.main.138:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.138:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 1676
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1676
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1676
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.141
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.139
+  mov rax, 0
+  call assert
+  jmp .Lend.main.139
+.Lcall.main.139:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.139:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  mov rax, rbp
+  sub rax, 1668
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1668
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1668
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.142
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.140
+  mov rax, 0
+  call assert
+  jmp .Lend.main.140
+.Lcall.main.140:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.140:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 1660
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1660
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1660
+  push rax
+  pop rax
+  add rax, 8
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1660
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.143
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.141
+  mov rax, 0
+  call assert
+  jmp .Lend.main.141
+.Lcall.main.141:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.141:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  mov rax, rbp
+  sub rax, 1648
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1648
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1648
+  push rax
+  pop rax
+  add rax, 8
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1648
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.144
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.142
+  mov rax, 0
+  call assert
+  jmp .Lend.main.142
+.Lcall.main.142:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.142:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 1636
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1636
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1636
+  push rax
+  pop rax
+  add rax, 8
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1636
+  push rax
+  pop rax
+  add rax, 8
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.145
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.143
+  mov rax, 0
+  call assert
+  jmp .Lend.main.143
+.Lcall.main.143:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.143:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  mov rax, rbp
+  sub rax, 1600
+  push rax
+  mov rax, rbp
+  sub rax, 1624
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1600
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1624
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.146
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.144
+  mov rax, 0
+  call assert
+  jmp .Lend.main.144
+.Lcall.main.144:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.144:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 1568
+  push rax
+  mov rax, rbp
+  sub rax, 1592
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1568
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1592
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.147
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.145
+  mov rax, 0
+  call assert
+  jmp .Lend.main.145
+.Lcall.main.145:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.145:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  mov rax, rbp
+  sub rax, 1536
+  push rax
+  mov rax, rbp
+  sub rax, 1560
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1536
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1560
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.148
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.146
+  mov rax, 0
+  call assert
+  jmp .Lend.main.146
+.Lcall.main.146:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.146:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 1504
+  push rax
+  mov rax, rbp
+  sub rax, 1528
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1504
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1528
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.149
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.147
+  mov rax, 0
+  call assert
+  jmp .Lend.main.147
+.Lcall.main.147:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.147:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 6
+  mov rax, rbp
+  sub rax, 1464
+  push rax
+  mov rax, rbp
+  sub rax, 1496
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1496
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 6
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1464
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.150
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.148
+  mov rax, 0
+  call assert
+  jmp .Lend.main.148
+.Lcall.main.148:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.148:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 7
+  mov rax, rbp
+  sub rax, 1424
+  push rax
+  mov rax, rbp
+  sub rax, 1456
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1456
+  push rax
+  pop rax
+  add rax, 12
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 7
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1424
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.151
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.149
+  mov rax, 0
+  call assert
+  jmp .Lend.main.149
+.Lcall.main.149:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.149:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 6
+  mov rax, rbp
+  sub rax, 1416
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 6
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1416
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.152
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.150
+  mov rax, 0
+  call assert
+  jmp .Lend.main.150
+.Lcall.main.150:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.150:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  push 4
+  push offset .L.data.main.153
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.151
+  mov rax, 0
+  call assert
+  jmp .Lend.main.151
+.Lcall.main.151:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.151:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  push offset .L.data.main.154
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.152
+  mov rax, 0
+  call assert
+  jmp .Lend.main.152
+.Lcall.main.152:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.152:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 12
+  push 12
+  push offset .L.data.main.155
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.153
+  mov rax, 0
+  call assert
+  jmp .Lend.main.153
+.Lcall.main.153:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.153:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 16
+  push 16
+  push offset .L.data.main.156
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.154
+  mov rax, 0
+  call assert
+  jmp .Lend.main.154
+.Lcall.main.154:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.154:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 24
+  push 24
+  push offset .L.data.main.157
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.155
+  mov rax, 0
+  call assert
+  jmp .Lend.main.155
+.Lcall.main.155:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.155:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  push 2
+  push offset .L.data.main.158
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.156
+  mov rax, 0
+  call assert
+  jmp .Lend.main.156
+.Lcall.main.156:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.156:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  push offset .L.data.main.159
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.157
+  mov rax, 0
+  call assert
+  jmp .Lend.main.157
+.Lcall.main.157:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.157:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  push offset .L.data.main.160
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.158
+  mov rax, 0
+  call assert
+  jmp .Lend.main.158
+.Lcall.main.158:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.158:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 7
+  mov rax, rbp
+  sub rax, 1320
+  push rax
+  mov rax, rbp
+  sub rax, 1328
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1316
+  push rax
+  mov rax, rbp
+  sub rax, 1321
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1316
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 1320
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  push offset .L.data.main.161
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.159
+  mov rax, 0
+  call assert
+  jmp .Lend.main.159
+.Lcall.main.159:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.159:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 1304
+  push rax
+  mov rax, rbp
+  sub rax, 1309
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1300
+  push rax
+  mov rax, rbp
+  sub rax, 1308
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1300
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 1304
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  push offset .L.data.main.162
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.160
+  mov rax, 0
+  call assert
+  jmp .Lend.main.160
+.Lcall.main.160:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.160:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  push 2
+  push offset .L.data.main.163
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.161
+  mov rax, 0
+  call assert
+  jmp .Lend.main.161
+.Lcall.main.161:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.161:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 1292
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1288
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1292
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 1288
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  push offset .L.data.main.164
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.162
+  mov rax, 0
+  call assert
+  jmp .Lend.main.162
+.Lcall.main.162:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.162:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 1280
+  push rax
+  mov rax, rbp
+  sub rax, 1281
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1281
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1280
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.165
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.163
+  mov rax, 0
+  call assert
+  jmp .Lend.main.163
+.Lcall.main.163:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.163:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 1264
+  push rax
+  mov rax, rbp
+  sub rax, 1265
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1264
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1265
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.166
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.164
+  mov rax, 0
+  call assert
+  jmp .Lend.main.164
+.Lcall.main.164:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.164:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 1256
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1256
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.167
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.165
+  mov rax, 0
+  call assert
+  jmp .Lend.main.165
+.Lcall.main.165:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.165:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 1252
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1252
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.168
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.166
+  mov rax, 0
+  call assert
+  jmp .Lend.main.166
+.Lcall.main.166:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.166:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 1248
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1248
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.169
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.167
+  mov rax, 0
+  call assert
+  jmp .Lend.main.167
+.Lcall.main.167:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.167:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  mov rax, rbp
+  sub rax, 1244
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1244
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.170
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.168
+  mov rax, 0
+  call assert
+  jmp .Lend.main.168
+.Lcall.main.168:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.168:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  push offset .L.data.main.171
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.169
+  mov rax, 0
+  call assert
+  jmp .Lend.main.169
+.Lcall.main.169:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.169:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  push offset .L.data.main.172
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.170
+  mov rax, 0
+  call assert
+  jmp .Lend.main.170
+.Lcall.main.170:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.170:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  push 2
+  push offset .L.data.main.173
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.171
+  mov rax, 0
+  call assert
+  jmp .Lend.main.171
+.Lcall.main.171:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.171:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  push 4
+  push offset .L.data.main.174
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.172
+  mov rax, 0
+  call assert
+  jmp .Lend.main.172
+.Lcall.main.172:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.172:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  push offset .L.data.main.175
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.173
+  mov rax, 0
+  call assert
+  jmp .Lend.main.173
+.Lcall.main.173:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.173:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 16
+  push 16
+  push offset .L.data.main.176
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.174
+  mov rax, 0
+  call assert
+  jmp .Lend.main.174
+.Lcall.main.174:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.174:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  push 7
+  push 3
+  push 3
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.175
+  mov rax, 0
+  call sub_short
+  jmp .Lend.main.175
+.Lcall.main.175:
+  sub rsp, 8
+  mov rax, 0
+  call sub_short
+  add rsp, 8
+.Lend.main.175:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  push offset .L.data.main.177
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.176
+  mov rax, 0
+  call assert
+  jmp .Lend.main.176
+.Lcall.main.176:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.176:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  push 7
+  push 3
+  push 3
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.177
+  mov rax, 0
+  call sub_long
+  jmp .Lend.main.177
+.Lcall.main.177:
+  sub rsp, 8
+  mov rax, 0
+  call sub_long
+  add rsp, 8
+.Lend.main.177:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  push offset .L.data.main.178
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.178
+  mov rax, 0
+  call assert
+  jmp .Lend.main.178
+.Lcall.main.178:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.178:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 24
+  push 24
+  push offset .L.data.main.179
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.179
+  mov rax, 0
+  call assert
+  jmp .Lend.main.179
+.Lcall.main.179:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.179:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  push offset .L.data.main.180
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.180
+  mov rax, 0
+  call assert
+  jmp .Lend.main.180
+.Lcall.main.180:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.180:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 1152
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 1128
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1128
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1152
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.181
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.181
+  mov rax, 0
+  call assert
+  jmp .Lend.main.181
+.Lcall.main.181:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.181:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  mov rax, rbp
+  sub rax, 1112
+  push rax
+  mov rax, rbp
+  sub rax, 1124
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1112
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1112
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.182
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.182
+  mov rax, 0
+  call assert
+  jmp .Lend.main.182
+.Lcall.main.182:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.182:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.183
+  mov rax, 0
+  call g1_ptr
+  jmp .Lend.main.183
+.Lcall.main.183:
+  sub rsp, 8
+  mov rax, 0
+  call g1_ptr
+  add rsp, 8
+.Lend.main.183:
+  push rax
+  pop rax
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.183
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.184
+  mov rax, 0
+  call assert
+  jmp .Lend.main.184
+.Lcall.main.184:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.184:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  mov rax, rbp
+  sub rax, 1096
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  cmp rdi, 0
+  setne dil
+  movzb rdi, dil
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1096
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.184
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.185
+  mov rax, 0
+  call assert
+  jmp .Lend.main.185
+.Lcall.main.185:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.185:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 1095
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  cmp rdi, 0
+  setne dil
+  movzb rdi, dil
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1095
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.185
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.186
+  mov rax, 0
+  call assert
+  jmp .Lend.main.186
+.Lcall.main.186:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.186:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 1094
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  cmp rdi, 0
+  setne dil
+  movzb rdi, dil
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1094
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.186
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.187
+  mov rax, 0
+  call assert
+  jmp .Lend.main.187
+.Lcall.main.187:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.187:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  push 1
+  push offset .L.data.main.187
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.188
+  mov rax, 0
+  call assert
+  jmp .Lend.main.188
+.Lcall.main.188:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.188:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  push 2
+  push offset .L.data.main.188
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.189
+  mov rax, 0
+  call assert
+  jmp .Lend.main.189
+.Lcall.main.189:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.189:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  push 2
+  push offset .L.data.main.189
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.190
+  mov rax, 0
+  call assert
+  jmp .Lend.main.190
+.Lcall.main.190:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.190:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  push 4
+  push offset .L.data.main.190
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.191
+  mov rax, 0
+  call assert
+  jmp .Lend.main.191
+.Lcall.main.191:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.191:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  push 4
+  push offset .L.data.main.191
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.192
+  mov rax, 0
+  call assert
+  jmp .Lend.main.192
+.Lcall.main.192:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.192:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  push offset .L.data.main.192
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.193
+  mov rax, 0
+  call assert
+  jmp .Lend.main.193
+.Lcall.main.193:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.193:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  push offset .L.data.main.193
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.194
+  mov rax, 0
+  call assert
+  jmp .Lend.main.194
+.Lcall.main.194:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.194:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  push 1
+  push offset .L.data.main.194
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.195
+  mov rax, 0
+  call assert
+  jmp .Lend.main.195
+.Lcall.main.195:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.195:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  push 2
+  push offset .L.data.main.195
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.196
+  mov rax, 0
+  call assert
+  jmp .Lend.main.196
+.Lcall.main.196:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.196:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  push 2
+  push offset .L.data.main.196
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.197
+  mov rax, 0
+  call assert
+  jmp .Lend.main.197
+.Lcall.main.197:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.197:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  push 2
+  push offset .L.data.main.197
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.198
+  mov rax, 0
+  call assert
+  jmp .Lend.main.198
+.Lcall.main.198:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.198:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  push 4
+  push offset .L.data.main.198
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.199
+  mov rax, 0
+  call assert
+  jmp .Lend.main.199
+.Lcall.main.199:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.199:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  push offset .L.data.main.199
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.200
+  mov rax, 0
+  call assert
+  jmp .Lend.main.200
+.Lcall.main.200:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.200:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  push offset .L.data.main.200
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.201
+  mov rax, 0
+  call assert
+  jmp .Lend.main.201
+.Lcall.main.201:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.201:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  push offset .L.data.main.201
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.202
+  mov rax, 0
+  call assert
+  jmp .Lend.main.202
+.Lcall.main.202:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.202:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  push offset .L.data.main.202
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.203
+  mov rax, 0
+  call assert
+  jmp .Lend.main.203
+.Lcall.main.203:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.203:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  push offset .L.data.main.203
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.204
+  mov rax, 0
+  call assert
+  jmp .Lend.main.204
+.Lcall.main.204:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.204:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  push offset .L.data.main.204
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.205
+  mov rax, 0
+  call assert
+  jmp .Lend.main.205
+.Lcall.main.205:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.205:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  push offset .L.data.main.205
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.206
+  mov rax, 0
+  call assert
+  jmp .Lend.main.206
+.Lcall.main.206:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.206:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  push offset .L.data.main.206
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.207
+  mov rax, 0
+  call assert
+  jmp .Lend.main.207
+.Lcall.main.207:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.207:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 32
+  push 32
+  push offset .L.data.main.207
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.208
+  mov rax, 0
+  call assert
+  jmp .Lend.main.208
+.Lcall.main.208:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.208:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 16
+  push 16
+  push offset .L.data.main.208
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.209
+  mov rax, 0
+  call assert
+  jmp .Lend.main.209
+.Lcall.main.209:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.209:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 48
+  push 48
+  push offset .L.data.main.209
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.210
+  mov rax, 0
+  call assert
+  jmp .Lend.main.210
+.Lcall.main.210:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.210:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  push 4
+  push offset .L.data.main.210
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.211
+  mov rax, 0
+  call assert
+  jmp .Lend.main.211
+.Lcall.main.211:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.211:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  movabs rax, 4294967297
+  push rax
+  movabs rax, 4294967297
+  push rax
+  push offset .L.data.main.211
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.212
+  mov rax, 0
+  call assert
+  jmp .Lend.main.212
+.Lcall.main.212:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.212:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  push offset .L.data.main.212
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.213
+  mov rax, 0
+  call assert
+  jmp .Lend.main.213
+.Lcall.main.213:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.213:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 131585
+  movabs rax, 8590066177
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  push offset .L.data.main.213
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.214
+  mov rax, 0
+  call assert
+  jmp .Lend.main.214
+.Lcall.main.214:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.214:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 513
+  movabs rax, 8590066177
+  push rax
+  pop rax
+  movsx eax, ax
+  push rax
+  push offset .L.data.main.214
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.215
+  mov rax, 0
+  call assert
+  jmp .Lend.main.215
+.Lcall.main.215:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.215:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  movabs rax, 8590066177
+  push rax
+  pop rax
+  movsx rax, al
+  push rax
+  push offset .L.data.main.215
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.216
+  mov rax, 0
+  call assert
+  jmp .Lend.main.216
+.Lcall.main.216:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.216:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  push 1
+  pop rax
+  cmp rax, 0
+  setne al
+  movsx rax, al
+  push rax
+  push offset .L.data.main.216
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.217
+  mov rax, 0
+  call assert
+  jmp .Lend.main.217
+.Lcall.main.217:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.217:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  push 2
+  pop rax
+  cmp rax, 0
+  setne al
+  movsx rax, al
+  push rax
+  push offset .L.data.main.217
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.218
+  mov rax, 0
+  call assert
+  jmp .Lend.main.218
+.Lcall.main.218:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.218:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push 256
+  pop rax
+  movsx rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  setne al
+  movsx rax, al
+  push rax
+  push offset .L.data.main.218
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.219
+  mov rax, 0
+  call assert
+  jmp .Lend.main.219
+.Lcall.main.219:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.219:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  push 1
+  pop rax
+  push rax
+  push offset .L.data.main.219
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.220
+  mov rax, 0
+  call assert
+  jmp .Lend.main.220
+.Lcall.main.220:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.220:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push 0
+  pop rax
+  push rax
+  pop rax
+  push rax
+  push offset .L.data.main.220
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.221
+  mov rax, 0
+  call assert
+  jmp .Lend.main.221
+.Lcall.main.221:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.221:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 5
+  mov rax, rbp
+  sub rax, 1060
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1056
+  push rax
+  mov rax, rbp
+  sub rax, 1060
+  push rax
+  pop rax
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1056
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rax
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.221
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.222
+  mov rax, 0
+  call assert
+  jmp .Lend.main.222
+.Lcall.main.222:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.222:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 97
+  push 97
+  push offset .L.data.main.222
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.223
+  mov rax, 0
+  call assert
+  jmp .Lend.main.223
+.Lcall.main.223:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.223:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 10
+  push 10
+  push offset .L.data.main.223
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.224
+  mov rax, 0
+  call assert
+  jmp .Lend.main.224
+.Lcall.main.224:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.224:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.225
+  mov rax, 0
+  call char_fn
+  jmp .Lend.main.225
+.Lcall.main.225:
+  sub rsp, 8
+  mov rax, 0
+  call char_fn
+  add rsp, 8
+.Lend.main.225:
+  push rax
+  pop rax
+  movsx rax, al
+  push rax
+  push offset .L.data.main.224
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.226
+  mov rax, 0
+  call assert
+  jmp .Lend.main.226
+.Lcall.main.226:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.226:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push 0
+  push offset .L.data.main.225
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.227
+  mov rax, 0
+  call assert
+  jmp .Lend.main.227
+.Lcall.main.227:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.227:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  push 1
+  push offset .L.data.main.226
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.228
+  mov rax, 0
+  call assert
+  jmp .Lend.main.228
+.Lcall.main.228:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.228:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  push 2
+  push offset .L.data.main.227
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.229
+  mov rax, 0
+  call assert
+  jmp .Lend.main.229
+.Lcall.main.229:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.229:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 5
+  push 5
+  push offset .L.data.main.228
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.230
+  mov rax, 0
+  call assert
+  jmp .Lend.main.230
+.Lcall.main.230:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.230:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 6
+  push 6
+  push offset .L.data.main.229
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.231
+  mov rax, 0
+  call assert
+  jmp .Lend.main.231
+.Lcall.main.231:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.231:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push 0
+  push offset .L.data.main.230
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.232
+  mov rax, 0
+  call assert
+  jmp .Lend.main.232
+.Lcall.main.232:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.232:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 5
+  push 5
+  push offset .L.data.main.231
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.233
+  mov rax, 0
+  call assert
+  jmp .Lend.main.233
+.Lcall.main.233:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.233:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  push 3
+  push offset .L.data.main.232
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.234
+  mov rax, 0
+  call assert
+  jmp .Lend.main.234
+.Lcall.main.234:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.234:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  push 4
+  push offset .L.data.main.233
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.235
+  mov rax, 0
+  call assert
+  jmp .Lend.main.235
+.Lcall.main.235:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.235:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  push 4
+  push offset .L.data.main.234
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.236
+  mov rax, 0
+  call assert
+  jmp .Lend.main.236
+.Lcall.main.236:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.236:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  push 4
+  push offset .L.data.main.235
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.237
+  mov rax, 0
+  call assert
+  jmp .Lend.main.237
+.Lcall.main.237:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.237:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.238
+  mov rax, 0
+  call count
+  jmp .Lend.main.238
+.Lcall.main.238:
+  sub rsp, 8
+  mov rax, 0
+  call count
+  add rsp, 8
+.Lend.main.238:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  push offset .L.data.main.236
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.239
+  mov rax, 0
+  call assert
+  jmp .Lend.main.239
+.Lcall.main.239:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.239:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.240
+  mov rax, 0
+  call count
+  jmp .Lend.main.240
+.Lcall.main.240:
+  sub rsp, 8
+  mov rax, 0
+  call count
+  add rsp, 8
+.Lend.main.240:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  push offset .L.data.main.237
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.241
+  mov rax, 0
+  call assert
+  jmp .Lend.main.241
+.Lcall.main.241:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.241:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.242
+  mov rax, 0
+  call count
+  jmp .Lend.main.242
+.Lcall.main.242:
+  sub rsp, 8
+  mov rax, 0
+  call count
+  add rsp, 8
+.Lend.main.242:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  push offset .L.data.main.238
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.243
+  mov rax, 0
+  call assert
+  jmp .Lend.main.243
+.Lcall.main.243:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.243:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 55
+  mov rax, rbp
+  sub rax, 1040
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1036
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.Lbegin.main.244:
+  mov rax, rbp
+  sub rax, 1036
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setle al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je  .L.break.main.244
+  mov rax, rbp
+  sub rax, 1040
+  push rax
+  mov rax, rbp
+  sub rax, 1040
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 1036
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.L.continue.main.244:
+  mov rax, rbp
+  sub rax, 1036
+  push rax
+  mov rax, rbp
+  sub rax, 1036
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp  .Lbegin.main.244
+.L.break.main.244:
+  mov rax, rbp
+  sub rax, 1040
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.239
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.245
+  mov rax, 0
+  call assert
+  jmp .Lend.main.245
+.Lcall.main.245:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.245:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 1032
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1028
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1024
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.Lbegin.main.246:
+  mov rax, rbp
+  sub rax, 1024
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setle al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je  .L.break.main.246
+  mov rax, rbp
+  sub rax, 1028
+  push rax
+  mov rax, rbp
+  sub rax, 1028
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 1024
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.L.continue.main.246:
+  mov rax, rbp
+  sub rax, 1024
+  push rax
+  mov rax, rbp
+  sub rax, 1024
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp  .Lbegin.main.246
+.L.break.main.246:
+  mov rax, rbp
+  sub rax, 1032
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.240
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.247
+  mov rax, 0
+  call assert
+  jmp .Lend.main.247
+.Lcall.main.247:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.247:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  push 1
+  add rsp, 8
+  push 2
+  add rsp, 8
+  push 3
+  push offset .L.data.main.241
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.248
+  mov rax, 0
+  call assert
+  jmp .Lend.main.248
+.Lcall.main.248:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.248:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 1020
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1020
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  push offset .L.data.main.242
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.249
+  mov rax, 0
+  call assert
+  jmp .Lend.main.249
+.Lcall.main.249:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.249:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 1016
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1016
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  sub rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  push offset .L.data.main.243
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.250
+  mov rax, 0
+  call assert
+  jmp .Lend.main.250
+.Lcall.main.250:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.250:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  mov rax, rbp
+  sub rax, 1012
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1012
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  push offset .L.data.main.244
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.251
+  mov rax, 0
+  call assert
+  jmp .Lend.main.251
+.Lcall.main.251:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.251:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  mov rax, rbp
+  sub rax, 1008
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1008
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  sub rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  add rax, 1
+  push rax
+  push offset .L.data.main.245
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.252
+  mov rax, 0
+  call assert
+  jmp .Lend.main.252
+.Lcall.main.252:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.252:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 1004
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1004
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1004
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.246
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.253
+  mov rax, 0
+  call assert
+  jmp .Lend.main.253
+.Lcall.main.253:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.253:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 1000
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1000
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  sub rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  add rax, 1
+  push rax
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1000
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.247
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.254
+  mov rax, 0
+  call assert
+  jmp .Lend.main.254
+.Lcall.main.254:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.254:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 996
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 996
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 996
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 984
+  push rax
+  mov rax, rbp
+  sub rax, 996
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 984
+  push rax
+  push [rsp]
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  pop rax
+  sub rax, 4
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.248
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.255
+  mov rax, 0
+  call assert
+  jmp .Lend.main.255
+.Lcall.main.255:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.255:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  mov rax, rbp
+  sub rax, 972
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 972
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 972
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 960
+  push rax
+  mov rax, rbp
+  sub rax, 972
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 960
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  push offset .L.data.main.249
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.256
+  mov rax, 0
+  call assert
+  jmp .Lend.main.256
+.Lcall.main.256:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.256:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 948
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 948
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 948
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 936
+  push rax
+  mov rax, rbp
+  sub rax, 948
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 936
+  push rax
+  push [rsp]
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rax
+  sub rax, 4
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  pop rax
+  add rax, 4
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.250
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.257
+  mov rax, 0
+  call assert
+  jmp .Lend.main.257
+.Lcall.main.257:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.257:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  mov rax, rbp
+  sub rax, 924
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 924
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 924
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 912
+  push rax
+  mov rax, rbp
+  sub rax, 924
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 912
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  sub rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  push offset .L.data.main.251
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.258
+  mov rax, 0
+  call assert
+  jmp .Lend.main.258
+.Lcall.main.258:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.258:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  mov rax, rbp
+  sub rax, 900
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 900
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 900
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 888
+  push rax
+  mov rax, rbp
+  sub rax, 900
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 888
+  push rax
+  push [rsp]
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  pop rax
+  sub rax, 4
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  sub rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  add rax, 1
+  push rax
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 900
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.252
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.259
+  mov rax, 0
+  call assert
+  jmp .Lend.main.259
+.Lcall.main.259:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.259:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  mov rax, rbp
+  sub rax, 876
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 876
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 876
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 864
+  push rax
+  mov rax, rbp
+  sub rax, 876
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 864
+  push rax
+  push [rsp]
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  pop rax
+  sub rax, 4
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  sub rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  add rax, 1
+  push rax
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 876
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.253
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.260
+  mov rax, 0
+  call assert
+  jmp .Lend.main.260
+.Lcall.main.260:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.260:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  mov rax, rbp
+  sub rax, 852
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 852
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 852
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 840
+  push rax
+  mov rax, rbp
+  sub rax, 852
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 840
+  push rax
+  push [rsp]
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  pop rax
+  sub rax, 4
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  sub rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  add rax, 1
+  push rax
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 852
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.254
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.261
+  mov rax, 0
+  call assert
+  jmp .Lend.main.261
+.Lcall.main.261:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.261:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  mov rax, rbp
+  sub rax, 828
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 828
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 828
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 816
+  push rax
+  mov rax, rbp
+  sub rax, 828
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 816
+  push rax
+  push [rsp]
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  pop rax
+  sub rax, 4
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  sub rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  add rax, 1
+  push rax
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 816
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.255
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.262
+  mov rax, 0
+  call assert
+  jmp .Lend.main.262
+.Lcall.main.262:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.262:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 7
+  mov rax, rbp
+  sub rax, 808
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 808
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 808
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.256
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.263
+  mov rax, 0
+  call assert
+  jmp .Lend.main.263
+.Lcall.main.263:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.263:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 7
+  mov rax, rbp
+  sub rax, 804
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 804
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  push offset .L.data.main.257
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.264
+  mov rax, 0
+  call assert
+  jmp .Lend.main.264
+.Lcall.main.264:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.264:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 800
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 800
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 800
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.258
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.265
+  mov rax, 0
+  call assert
+  jmp .Lend.main.265
+.Lcall.main.265:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.265:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 796
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 796
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  push offset .L.data.main.259
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.266
+  mov rax, 0
+  call assert
+  jmp .Lend.main.266
+.Lcall.main.266:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.266:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 6
+  mov rax, rbp
+  sub rax, 792
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 792
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 792
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.260
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.267
+  mov rax, 0
+  call assert
+  jmp .Lend.main.267
+.Lcall.main.267:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.267:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 6
+  mov rax, rbp
+  sub rax, 788
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 788
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  push offset .L.data.main.261
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.268
+  mov rax, 0
+  call assert
+  jmp .Lend.main.268
+.Lcall.main.268:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.268:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 784
+  push rax
+  push 6
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 784
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  cqo
+  idiv rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 784
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.262
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.269
+  mov rax, 0
+  call assert
+  jmp .Lend.main.269
+.Lcall.main.269:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.269:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 780
+  push rax
+  push 6
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 780
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  cqo
+  idiv rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  push offset .L.data.main.263
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.270
+  mov rax, 0
+  call assert
+  jmp .Lend.main.270
+.Lcall.main.270:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.270:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push 1
+  pop rax
+  cmp rax, 0
+  sete al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.264
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.271
+  mov rax, 0
+  call assert
+  jmp .Lend.main.271
+.Lcall.main.271:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.271:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push 2
+  pop rax
+  cmp rax, 0
+  sete al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.265
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.272
+  mov rax, 0
+  call assert
+  jmp .Lend.main.272
+.Lcall.main.272:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.272:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  push 0
+  pop rax
+  cmp rax, 0
+  sete al
+  movzb rax, al
+  push rax
+  push offset .L.data.main.266
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.273
+  mov rax, 0
+  call assert
+  jmp .Lend.main.273
+.Lcall.main.273:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.273:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  push 0
+  pop rax
+  not rax
+  push rax
+  push offset .L.data.main.267
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.274
+  mov rax, 0
+  call assert
+  jmp .Lend.main.274
+.Lcall.main.274:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.274:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rax
+  not rax
+  push rax
+  push offset .L.data.main.268
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.275
+  mov rax, 0
+  call assert
+  jmp .Lend.main.275
+.Lcall.main.275:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.275:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  and rax, rdi
+  push rax
+  push offset .L.data.main.269
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.276
+  mov rax, 0
+  call assert
+  jmp .Lend.main.276
+.Lcall.main.276:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.276:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  push 3
+  push 1
+  pop rdi
+  pop rax
+  and rax, rdi
+  push rax
+  push offset .L.data.main.270
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.277
+  mov rax, 0
+  call assert
+  jmp .Lend.main.277
+.Lcall.main.277:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.277:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  push 7
+  push 3
+  pop rdi
+  pop rax
+  and rax, rdi
+  push rax
+  push offset .L.data.main.271
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.278
+  mov rax, 0
+  call assert
+  jmp .Lend.main.278
+.Lcall.main.278:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.278:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 10
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  and rax, rdi
+  push rax
+  push offset .L.data.main.272
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.279
+  mov rax, 0
+  call assert
+  jmp .Lend.main.279
+.Lcall.main.279:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.279:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  or rax, rdi
+  push rax
+  push offset .L.data.main.273
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.280
+  mov rax, 0
+  call assert
+  jmp .Lend.main.280
+.Lcall.main.280:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.280:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  push 2
+  push 1
+  pop rdi
+  pop rax
+  or rax, rdi
+  push rax
+  push offset .L.data.main.274
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.281
+  mov rax, 0
+  call assert
+  jmp .Lend.main.281
+.Lcall.main.281:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.281:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  push 1
+  push 3
+  pop rdi
+  pop rax
+  or rax, rdi
+  push rax
+  push offset .L.data.main.275
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.282
+  mov rax, 0
+  call assert
+  jmp .Lend.main.282
+.Lcall.main.282:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.282:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push 0
+  push 0
+  pop rdi
+  pop rax
+  xor rax, rdi
+  push rax
+  push offset .L.data.main.276
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.283
+  mov rax, 0
+  call assert
+  jmp .Lend.main.283
+.Lcall.main.283:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.283:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push 8
+  push 8
+  pop rdi
+  pop rax
+  xor rax, rdi
+  push rax
+  push offset .L.data.main.277
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.284
+  mov rax, 0
+  call assert
+  jmp .Lend.main.284
+.Lcall.main.284:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.284:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  push 7
+  push 3
+  pop rdi
+  pop rax
+  xor rax, rdi
+  push rax
+  push offset .L.data.main.278
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.285
+  mov rax, 0
+  call assert
+  jmp .Lend.main.285
+.Lcall.main.285:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.285:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  push 7
+  push 5
+  pop rdi
+  pop rax
+  xor rax, rdi
+  push rax
+  push offset .L.data.main.279
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.286
+  mov rax, 0
+  call assert
+  jmp .Lend.main.286
+.Lcall.main.286:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.286:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  push 0
+  pop rax
+  cmp rax, 0
+  jne .Ltrue.main.287
+  push 1
+  pop rax
+  cmp rax, 0
+  jne .Ltrue.main.287
+  push 0
+  jmp .Lend.main.287
+.Ltrue.main.287:
+  push 1
+.Lend.main.287:
+  push offset .L.data.main.280
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.288
+  mov rax, 0
+  call assert
+  jmp .Lend.main.288
+.Lcall.main.288:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.288:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  push 0
+  pop rax
+  cmp rax, 0
+  jne .Ltrue.main.290
+  push 2
+  push 2
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rax
+  cmp rax, 0
+  jne .Ltrue.main.290
+  push 0
+  jmp .Lend.main.290
+.Ltrue.main.290:
+  push 1
+.Lend.main.290:
+  pop rax
+  cmp rax, 0
+  jne .Ltrue.main.289
+  push 5
+  pop rax
+  cmp rax, 0
+  jne .Ltrue.main.289
+  push 0
+  jmp .Lend.main.289
+.Ltrue.main.289:
+  push 1
+.Lend.main.289:
+  push offset .L.data.main.281
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.291
+  mov rax, 0
+  call assert
+  jmp .Lend.main.291
+.Lcall.main.291:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.291:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push 0
+  pop rax
+  cmp rax, 0
+  jne .Ltrue.main.292
+  push 0
+  pop rax
+  cmp rax, 0
+  jne .Ltrue.main.292
+  push 0
+  jmp .Lend.main.292
+.Ltrue.main.292:
+  push 1
+.Lend.main.292:
+  push offset .L.data.main.282
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.293
+  mov rax, 0
+  call assert
+  jmp .Lend.main.293
+.Lcall.main.293:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.293:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push 0
+  pop rax
+  cmp rax, 0
+  jne .Ltrue.main.294
+  push 2
+  push 2
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rax
+  cmp rax, 0
+  jne .Ltrue.main.294
+  push 0
+  jmp .Lend.main.294
+.Ltrue.main.294:
+  push 1
+.Lend.main.294:
+  push offset .L.data.main.283
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.295
+  mov rax, 0
+  call assert
+  jmp .Lend.main.295
+.Lcall.main.295:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.295:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push 0
+  pop rax
+  cmp rax, 0
+  je  .Lfalse.main.296
+  push 1
+  pop rax
+  cmp rax, 0
+  je  .Lfalse.main.296
+  push 1
+  jmp .Lend.main.296
+.Lfalse.main.296:
+  push 0
+.Lend.main.296:
+  push offset .L.data.main.284
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.297
+  mov rax, 0
+  call assert
+  jmp .Lend.main.297
+.Lcall.main.297:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.297:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push 2
+  push 2
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rax
+  cmp rax, 0
+  je  .Lfalse.main.298
+  push 5
+  pop rax
+  cmp rax, 0
+  je  .Lfalse.main.298
+  push 1
+  jmp .Lend.main.298
+.Lfalse.main.298:
+  push 0
+.Lend.main.298:
+  push offset .L.data.main.285
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.299
+  mov rax, 0
+  call assert
+  jmp .Lend.main.299
+.Lcall.main.299:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.299:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  push 1
+  pop rax
+  cmp rax, 0
+  je  .Lfalse.main.300
+  push 5
+  pop rax
+  cmp rax, 0
+  je  .Lfalse.main.300
+  push 1
+  jmp .Lend.main.300
+.Lfalse.main.300:
+  push 0
+.Lend.main.300:
+  push offset .L.data.main.286
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.301
+  mov rax, 0
+  call assert
+  jmp .Lend.main.301
+.Lcall.main.301:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.301:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 776
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 776
+  push rax
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.302
+  mov rax, 0
+  call param_decay
+  jmp .Lend.main.302
+.Lcall.main.302:
+  sub rsp, 8
+  mov rax, 0
+  call param_decay
+  add rsp, 8
+.Lend.main.302:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  push offset .L.data.main.287
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.303
+  mov rax, 0
+  call assert
+  jmp .Lend.main.303
+.Lcall.main.303:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.303:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  push offset .L.data.main.288
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.304
+  mov rax, 0
+  call assert
+  jmp .Lend.main.304
+.Lcall.main.304:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.304:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  push 4
+  push offset .L.data.main.289
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.305
+  mov rax, 0
+  call assert
+  jmp .Lend.main.305
+.Lcall.main.305:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.305:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 736
+  push rax
+  pop rax
+  add rax, 8
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 752
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  mov rax, rbp
+  sub rax, 736
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 752
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rax
+  add rax, 8
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.290
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.306
+  mov rax, 0
+  call assert
+  jmp .Lend.main.306
+.Lcall.main.306:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.306:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 720
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.Lbegin.main.307:
+  mov rax, rbp
+  sub rax, 720
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je  .L.break.main.307
+  mov rax, rbp
+  sub rax, 720
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  sete al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je  .Lend.main.308
+  jmp .L.break.main.307
+.Lend.main.308:
+.L.continue.main.307:
+  mov rax, rbp
+  sub rax, 720
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+  jmp  .Lbegin.main.307
+.L.break.main.307:
+  mov rax, rbp
+  sub rax, 720
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.291
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.309
+  mov rax, 0
+  call assert
+  jmp .Lend.main.309
+.Lcall.main.309:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.309:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  mov rax, rbp
+  sub rax, 716
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.L.continue.main.310:
+  push 1
+  pop rax
+  cmp rax, 0
+  je  .L.break.main.310
+  mov rax, rbp
+  sub rax, 716
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  sete al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je  .Lend.main.311
+  jmp .L.break.main.310
+.Lend.main.311:
+  jmp .L.continue.main.310
+.L.break.main.310:
+  mov rax, rbp
+  sub rax, 716
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.292
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.312
+  mov rax, 0
+  call assert
+  jmp .Lend.main.312
+.Lcall.main.312:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.312:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 712
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.Lbegin.main.313:
+  mov rax, rbp
+  sub rax, 712
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je  .L.break.main.313
+.Lbegin.main.314:
+  jmp .L.break.main.314
+.L.continue.main.314:
+  jmp  .Lbegin.main.314
+.L.break.main.314:
+  mov rax, rbp
+  sub rax, 712
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  sete al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je  .Lend.main.315
+  jmp .L.break.main.313
+.Lend.main.315:
+.L.continue.main.313:
+  mov rax, rbp
+  sub rax, 712
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+  jmp  .Lbegin.main.313
+.L.break.main.313:
+  mov rax, rbp
+  sub rax, 712
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.293
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.316
+  mov rax, 0
+  call assert
+  jmp .Lend.main.316
+.Lcall.main.316:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.316:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  mov rax, rbp
+  sub rax, 708
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.L.continue.main.317:
+  push 1
+  pop rax
+  cmp rax, 0
+  je  .L.break.main.317
+.L.continue.main.318:
+  push 1
+  pop rax
+  cmp rax, 0
+  je  .L.break.main.318
+  jmp .L.break.main.318
+  jmp .L.continue.main.318
+.L.break.main.318:
+  mov rax, rbp
+  sub rax, 708
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  sete al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je  .Lend.main.319
+  jmp .L.break.main.317
+.Lend.main.319:
+  jmp .L.continue.main.317
+.L.break.main.317:
+  mov rax, rbp
+  sub rax, 708
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.294
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.320
+  mov rax, 0
+  call assert
+  jmp .Lend.main.320
+.Lcall.main.320:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.320:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 10
+  mov rax, rbp
+  sub rax, 704
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 700
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.Lbegin.main.321:
+  mov rax, rbp
+  sub rax, 704
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je  .L.break.main.321
+  push 5
+  mov rax, rbp
+  sub rax, 704
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je  .Lend.main.322
+  jmp .L.continue.main.321
+.Lend.main.322:
+  mov rax, rbp
+  sub rax, 700
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+.L.continue.main.321:
+  mov rax, rbp
+  sub rax, 704
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+  jmp  .Lbegin.main.321
+.L.break.main.321:
+  mov rax, rbp
+  sub rax, 704
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.295
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.323
+  mov rax, 0
+  call assert
+  jmp .Lend.main.323
+.Lcall.main.323:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.323:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 6
+  mov rax, rbp
+  sub rax, 696
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 692
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.Lbegin.main.324:
+  mov rax, rbp
+  sub rax, 696
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je  .L.break.main.324
+  push 5
+  mov rax, rbp
+  sub rax, 696
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je  .Lend.main.325
+  jmp .L.continue.main.324
+.Lend.main.325:
+  mov rax, rbp
+  sub rax, 692
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+.L.continue.main.324:
+  mov rax, rbp
+  sub rax, 696
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+  jmp  .Lbegin.main.324
+.L.break.main.324:
+  mov rax, rbp
+  sub rax, 692
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.296
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.326
+  mov rax, 0
+  call assert
+  jmp .Lend.main.326
+.Lcall.main.326:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.326:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 10
+  mov rax, rbp
+  sub rax, 688
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 684
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.Lbegin.main.327:
+  mov rax, rbp
+  sub rax, 688
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  cmp rax, 0
+  sete al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je  .L.break.main.327
+.Lbegin.main.328:
+  mov rax, rbp
+  sub rax, 684
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setne al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je  .L.break.main.328
+  jmp .L.continue.main.328
+.L.continue.main.328:
+  mov rax, rbp
+  sub rax, 684
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+  jmp  .Lbegin.main.328
+.L.break.main.328:
+  jmp .L.break.main.327
+.L.continue.main.327:
+  jmp  .Lbegin.main.327
+.L.break.main.327:
+  mov rax, rbp
+  sub rax, 684
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.297
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.329
+  mov rax, 0
+  call assert
+  jmp .Lend.main.329
+.Lcall.main.329:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.329:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 11
+  mov rax, rbp
+  sub rax, 680
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 676
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.L.continue.main.330:
+  mov rax, rbp
+  sub rax, 680
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je  .L.break.main.330
+  push 5
+  mov rax, rbp
+  sub rax, 680
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je  .Lend.main.331
+  jmp .L.continue.main.330
+.Lend.main.331:
+  mov rax, rbp
+  sub rax, 676
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+  jmp .L.continue.main.330
+.L.break.main.330:
+  mov rax, rbp
+  sub rax, 680
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.298
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.332
+  mov rax, 0
+  call assert
+  jmp .Lend.main.332
+.Lcall.main.332:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.332:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 5
+  mov rax, rbp
+  sub rax, 672
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 668
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.L.continue.main.333:
+  mov rax, rbp
+  sub rax, 672
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je  .L.break.main.333
+  push 5
+  mov rax, rbp
+  sub rax, 672
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setl al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je  .Lend.main.334
+  jmp .L.continue.main.333
+.Lend.main.334:
+  mov rax, rbp
+  sub rax, 668
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+  jmp .L.continue.main.333
+.L.break.main.333:
+  mov rax, rbp
+  sub rax, 668
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.299
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.335
+  mov rax, 0
+  call assert
+  jmp .Lend.main.335
+.Lcall.main.335:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.335:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 11
+  mov rax, rbp
+  sub rax, 664
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 660
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+.L.continue.main.336:
+  mov rax, rbp
+  sub rax, 664
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  cmp rax, 0
+  sete al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je  .L.break.main.336
+.L.continue.main.337:
+  mov rax, rbp
+  sub rax, 660
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  setne al
+  movzb rax, al
+  push rax
+  pop rax
+  cmp rax, 0
+  je  .L.break.main.337
+  jmp .L.continue.main.337
+  jmp .L.continue.main.337
+.L.break.main.337:
+  jmp .L.break.main.336
+  jmp .L.continue.main.336
+.L.break.main.336:
+  mov rax, rbp
+  sub rax, 660
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.300
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.338
+  mov rax, 0
+  call assert
+  jmp .Lend.main.338
+.Lcall.main.338:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.338:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 656
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp .L.label.main.a
+.L.label.main.a:
+  mov rax, rbp
+  sub rax, 656
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+.L.label.main.b:
+  mov rax, rbp
+  sub rax, 656
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+.L.label.main.c:
+  mov rax, rbp
+  sub rax, 656
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 656
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.301
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.339
+  mov rax, 0
+  call assert
+  jmp .Lend.main.339
+.Lcall.main.339:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.339:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  mov rax, rbp
+  sub rax, 652
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp .L.label.main.e
+.L.label.main.d:
+  mov rax, rbp
+  sub rax, 652
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+.L.label.main.e:
+  mov rax, rbp
+  sub rax, 652
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+.L.label.main.f:
+  mov rax, rbp
+  sub rax, 652
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 652
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.302
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.340
+  mov rax, 0
+  call assert
+  jmp .Lend.main.340
+.Lcall.main.340:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.340:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 648
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp .L.label.main.i
+.L.label.main.g:
+  mov rax, rbp
+  sub rax, 648
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+.L.label.main.h:
+  mov rax, rbp
+  sub rax, 648
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+.L.label.main.i:
+  mov rax, rbp
+  sub rax, 648
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 648
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.303
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.341
+  mov rax, 0
+  call assert
+  jmp .Lend.main.341
+.Lcall.main.341:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.341:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 5
+  mov rax, rbp
+  sub rax, 644
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rax
+  cmp rax, 2
+  je .L.case.main.343
+  cmp rax, 1
+  je .L.case.main.344
+  cmp rax, 0
+  je .L.case.main.345
+  jmp .L.break.main.342
+.L.case.main.345:
+  mov rax, rbp
+  sub rax, 644
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp .L.break.main.342
+  jmp .L.break.main.342
+.L.case.main.344:
+  mov rax, rbp
+  sub rax, 644
+  push rax
+  push 6
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp .L.break.main.342
+  jmp .L.break.main.342
+.L.case.main.343:
+  mov rax, rbp
+  sub rax, 644
+  push rax
+  push 7
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp .L.break.main.342
+  jmp .L.break.main.342
+.L.break.main.342:
+  mov rax, rbp
+  sub rax, 644
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.304
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.346
+  mov rax, 0
+  call assert
+  jmp .Lend.main.346
+.Lcall.main.346:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.346:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 6
+  mov rax, rbp
+  sub rax, 640
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  push 1
+  pop rax
+  cmp rax, 2
+  je .L.case.main.348
+  cmp rax, 1
+  je .L.case.main.349
+  cmp rax, 0
+  je .L.case.main.350
+  jmp .L.break.main.347
+.L.case.main.350:
+  mov rax, rbp
+  sub rax, 640
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp .L.break.main.347
+  jmp .L.break.main.347
+.L.case.main.349:
+  mov rax, rbp
+  sub rax, 640
+  push rax
+  push 6
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp .L.break.main.347
+  jmp .L.break.main.347
+.L.case.main.348:
+  mov rax, rbp
+  sub rax, 640
+  push rax
+  push 7
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp .L.break.main.347
+  jmp .L.break.main.347
+.L.break.main.347:
+  mov rax, rbp
+  sub rax, 640
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.305
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.351
+  mov rax, 0
+  call assert
+  jmp .Lend.main.351
+.Lcall.main.351:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.351:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 7
+  mov rax, rbp
+  sub rax, 636
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  push 2
+  pop rax
+  cmp rax, 2
+  je .L.case.main.353
+  cmp rax, 1
+  je .L.case.main.354
+  cmp rax, 0
+  je .L.case.main.355
+  jmp .L.break.main.352
+.L.case.main.355:
+  mov rax, rbp
+  sub rax, 636
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp .L.break.main.352
+  jmp .L.break.main.352
+.L.case.main.354:
+  mov rax, rbp
+  sub rax, 636
+  push rax
+  push 6
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp .L.break.main.352
+  jmp .L.break.main.352
+.L.case.main.353:
+  mov rax, rbp
+  sub rax, 636
+  push rax
+  push 7
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp .L.break.main.352
+  jmp .L.break.main.352
+.L.break.main.352:
+  mov rax, rbp
+  sub rax, 636
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.306
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.356
+  mov rax, 0
+  call assert
+  jmp .Lend.main.356
+.Lcall.main.356:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.356:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  mov rax, rbp
+  sub rax, 632
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  push 3
+  pop rax
+  cmp rax, 2
+  je .L.case.main.358
+  cmp rax, 1
+  je .L.case.main.359
+  cmp rax, 0
+  je .L.case.main.360
+  jmp .L.break.main.357
+.L.case.main.360:
+  mov rax, rbp
+  sub rax, 632
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp .L.break.main.357
+  jmp .L.break.main.357
+.L.case.main.359:
+  mov rax, rbp
+  sub rax, 632
+  push rax
+  push 6
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp .L.break.main.357
+  jmp .L.break.main.357
+.L.case.main.358:
+  mov rax, rbp
+  sub rax, 632
+  push rax
+  push 7
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp .L.break.main.357
+  jmp .L.break.main.357
+.L.break.main.357:
+  mov rax, rbp
+  sub rax, 632
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.307
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.361
+  mov rax, 0
+  call assert
+  jmp .Lend.main.361
+.Lcall.main.361:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.361:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 5
+  mov rax, rbp
+  sub rax, 628
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rax
+  cmp rax, 0
+  je .L.case.main.363
+  jmp .L.case.main.364
+  jmp .L.break.main.362
+.L.case.main.363:
+  mov rax, rbp
+  sub rax, 628
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp .L.break.main.362
+  jmp .L.break.main.362
+.L.case.main.364:
+  mov rax, rbp
+  sub rax, 628
+  push rax
+  push 7
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp .L.break.main.362
+.L.break.main.362:
+  mov rax, rbp
+  sub rax, 628
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.308
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.365
+  mov rax, 0
+  call assert
+  jmp .Lend.main.365
+.Lcall.main.365:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.365:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 7
+  mov rax, rbp
+  sub rax, 624
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  push 1
+  pop rax
+  cmp rax, 0
+  je .L.case.main.367
+  jmp .L.case.main.368
+  jmp .L.break.main.366
+.L.case.main.367:
+  mov rax, rbp
+  sub rax, 624
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp .L.break.main.366
+  jmp .L.break.main.366
+.L.case.main.368:
+  mov rax, rbp
+  sub rax, 624
+  push rax
+  push 7
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  jmp .L.break.main.366
+.L.break.main.366:
+  mov rax, rbp
+  sub rax, 624
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.309
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.369
+  mov rax, 0
+  call assert
+  jmp .Lend.main.369
+.Lcall.main.369:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.369:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.370
+  mov rax, 0
+  call voidfn
+  jmp .Lend.main.370
+.Lcall.main.370:
+  sub rsp, 8
+  mov rax, 0
+  call voidfn
+  add rsp, 8
+.Lend.main.370:
+  push rax
+  add rsp, 8
+  push 1
+  push 1
+  push 0
+  pop rdi
+  pop rax
+  mov cl, dil
+  shl rax, cl
+  push rax
+  push offset .L.data.main.310
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.371
+  mov rax, 0
+  call assert
+  jmp .Lend.main.371
+.Lcall.main.371:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.371:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 8
+  push 1
+  push 3
+  pop rdi
+  pop rax
+  mov cl, dil
+  shl rax, cl
+  push rax
+  push offset .L.data.main.311
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.372
+  mov rax, 0
+  call assert
+  jmp .Lend.main.372
+.Lcall.main.372:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.372:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 10
+  push 5
+  push 1
+  pop rdi
+  pop rax
+  mov cl, dil
+  shl rax, cl
+  push rax
+  push offset .L.data.main.312
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.373
+  mov rax, 0
+  call assert
+  jmp .Lend.main.373
+.Lcall.main.373:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.373:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  push 5
+  push 1
+  pop rdi
+  pop rax
+  mov cl, dil
+  sar rax, cl
+  push rax
+  push offset .L.data.main.313
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.374
+  mov rax, 0
+  call assert
+  jmp .Lend.main.374
+.Lcall.main.374:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.374:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov cl, dil
+  sar rax, cl
+  push rax
+  push offset .L.data.main.314
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.375
+  mov rax, 0
+  call assert
+  jmp .Lend.main.375
+.Lcall.main.375:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.375:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 620
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 620
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov cl, dil
+  shl rax, cl
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 620
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.315
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.376
+  mov rax, 0
+  call assert
+  jmp .Lend.main.376
+.Lcall.main.376:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.376:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 8
+  mov rax, rbp
+  sub rax, 616
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 616
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov cl, dil
+  shl rax, cl
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 616
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.316
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.377
+  mov rax, 0
+  call assert
+  jmp .Lend.main.377
+.Lcall.main.377:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.377:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 10
+  mov rax, rbp
+  sub rax, 612
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 612
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov cl, dil
+  shl rax, cl
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 612
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.317
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.378
+  mov rax, 0
+  call assert
+  jmp .Lend.main.378
+.Lcall.main.378:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.378:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  mov rax, rbp
+  sub rax, 608
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 608
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov cl, dil
+  sar rax, cl
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 608
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.318
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.379
+  mov rax, 0
+  call assert
+  jmp .Lend.main.379
+.Lcall.main.379:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.379:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  push offset .L.data.main.319
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.380
+  mov rax, 0
+  call assert
+  jmp .Lend.main.380
+.Lcall.main.380:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.380:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 604
+  push rax
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 604
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.320
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.381
+  mov rax, 0
+  call assert
+  jmp .Lend.main.381
+.Lcall.main.381:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.381:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 600
+  push rax
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 600
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov cl, dil
+  sar rax, cl
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 600
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.321
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.382
+  mov rax, 0
+  call assert
+  jmp .Lend.main.382
+.Lcall.main.382:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.382:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  push 0
+  pop rax
+  cmp rax, 0
+  je  .Lelse.main.383
+  push 1
+  jmp .Lend.main.383
+.Lelse.main.383:
+  push 2
+.Lend.main.383:
+  push offset .L.data.main.322
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.384
+  mov rax, 0
+  call assert
+  jmp .Lend.main.384
+.Lcall.main.384:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.384:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  push 1
+  pop rax
+  cmp rax, 0
+  je  .Lelse.main.385
+  push 1
+  jmp .Lend.main.385
+.Lelse.main.385:
+  push 2
+.Lend.main.385:
+  push offset .L.data.main.323
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.386
+  mov rax, 0
+  call assert
+  jmp .Lend.main.386
+.Lcall.main.386:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.386:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 10
+  push 10
+  push offset .L.data.main.324
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.387
+  mov rax, 0
+  call assert
+  jmp .Lend.main.387
+.Lcall.main.387:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.387:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 596
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  push 3
+  pop rax
+  cmp rax, 3
+  je .L.case.main.389
+  jmp .L.break.main.388
+.L.case.main.389:
+  mov rax, rbp
+  sub rax, 596
+  push rax
+  push [rsp]
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  pop rax
+  add rax, 1
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  pop rax
+  sub rax, 1
+  push rax
+  add rsp, 8
+  jmp .L.break.main.388
+.L.break.main.388:
+  mov rax, rbp
+  sub rax, 596
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.325
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.390
+  mov rax, 0
+  call assert
+  jmp .Lend.main.390
+.Lcall.main.390:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.390:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  push offset .L.data.main.326
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.391
+  mov rax, 0
+  call assert
+  jmp .Lend.main.391
+.Lcall.main.391:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.391:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  push 2
+  push offset .L.data.main.327
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.392
+  mov rax, 0
+  call assert
+  jmp .Lend.main.392
+.Lcall.main.392:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.392:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  push 3
+  push offset .L.data.main.328
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.393
+  mov rax, 0
+  call assert
+  jmp .Lend.main.393
+.Lcall.main.393:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.393:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 576
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 576
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 576
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 576
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.329
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.394
+  mov rax, 0
+  call assert
+  jmp .Lend.main.394
+.Lcall.main.394:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.394:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  mov rax, rbp
+  sub rax, 564
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 564
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 564
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 564
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.330
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.395
+  mov rax, 0
+  call assert
+  jmp .Lend.main.395
+.Lcall.main.395:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.395:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 552
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 552
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 552
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 552
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.331
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.396
+  mov rax, 0
+  call assert
+  jmp .Lend.main.396
+.Lcall.main.396:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.396:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 540
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 540
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 540
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 540
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.332
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.397
+  mov rax, 0
+  call assert
+  jmp .Lend.main.397
+.Lcall.main.397:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.397:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  mov rax, rbp
+  sub rax, 528
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 528
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 528
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 528
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 528
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 528
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 6
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 528
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.333
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.398
+  mov rax, 0
+  call assert
+  jmp .Lend.main.398
+.Lcall.main.398:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.398:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  mov rax, rbp
+  sub rax, 504
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 504
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 504
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 504
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 504
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 504
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 6
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 504
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.334
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.399
+  mov rax, 0
+  call assert
+  jmp .Lend.main.399
+.Lcall.main.399:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.399:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 6
+  mov rax, rbp
+  sub rax, 480
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 480
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 480
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 480
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 480
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 480
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 6
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 480
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.335
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.400
+  mov rax, 0
+  call assert
+  jmp .Lend.main.400
+.Lcall.main.400:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.400:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  mov rax, rbp
+  sub rax, 456
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 456
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 456
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 456
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 456
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 456
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 456
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.336
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.401
+  mov rax, 0
+  call assert
+  jmp .Lend.main.401
+.Lcall.main.401:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.401:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  mov rax, rbp
+  sub rax, 432
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 432
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 432
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 432
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 432
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 432
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 432
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.337
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.402
+  mov rax, 0
+  call assert
+  jmp .Lend.main.402
+.Lcall.main.402:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.402:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  mov rax, rbp
+  sub rax, 408
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 408
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 408
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 408
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 408
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 408
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 408
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.338
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.403
+  mov rax, 0
+  call assert
+  jmp .Lend.main.403
+.Lcall.main.403:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.403:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 384
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 384
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 384
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 384
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 384
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 384
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 384
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.339
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.404
+  mov rax, 0
+  call assert
+  jmp .Lend.main.404
+.Lcall.main.404:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.404:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  mov rax, rbp
+  sub rax, 360
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 360
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 360
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 360
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 360
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 360
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 360
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.340
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.405
+  mov rax, 0
+  call assert
+  jmp .Lend.main.405
+.Lcall.main.405:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.405:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  mov rax, rbp
+  sub rax, 336
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 336
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 336
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 336
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 336
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 336
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 336
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.341
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.406
+  mov rax, 0
+  call assert
+  jmp .Lend.main.406
+.Lcall.main.406:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.406:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  mov rax, rbp
+  sub rax, 312
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 312
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 312
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 312
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 312
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 312
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 312
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.342
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.407
+  mov rax, 0
+  call assert
+  jmp .Lend.main.407
+.Lcall.main.407:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.407:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  mov rax, rbp
+  sub rax, 288
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 288
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 288
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 288
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 288
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 288
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 288
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.343
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.408
+  mov rax, 0
+  call assert
+  jmp .Lend.main.408
+.Lcall.main.408:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.408:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  mov rax, rbp
+  sub rax, 264
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 264
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 264
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 264
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 264
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 264
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 264
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.344
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.409
+  mov rax, 0
+  call assert
+  jmp .Lend.main.409
+.Lcall.main.409:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.409:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 97
+  mov rax, rbp
+  sub rax, 240
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 97
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 240
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 98
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 240
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 99
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 240
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 240
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.345
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.410
+  mov rax, 0
+  call assert
+  jmp .Lend.main.410
+.Lcall.main.410:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.410:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 99
+  mov rax, rbp
+  sub rax, 236
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 97
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 236
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 98
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 236
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 99
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 236
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 236
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.346
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.411
+  mov rax, 0
+  call assert
+  jmp .Lend.main.411
+.Lcall.main.411:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.411:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  mov rax, rbp
+  sub rax, 232
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 97
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 232
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 98
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 232
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 99
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 232
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 232
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.347
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.412
+  mov rax, 0
+  call assert
+  jmp .Lend.main.412
+.Lcall.main.412:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.412:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 97
+  mov rax, rbp
+  sub rax, 228
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 97
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 228
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 98
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 228
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 99
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 228
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 228
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 100
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 228
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 101
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 228
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 102
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 228
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 228
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.348
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.413
+  mov rax, 0
+  call assert
+  jmp .Lend.main.413
+.Lcall.main.413:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.413:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  mov rax, rbp
+  sub rax, 220
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 97
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 220
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 98
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 220
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 99
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 220
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 220
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 100
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 220
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 101
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 220
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 102
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 220
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 220
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.349
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.414
+  mov rax, 0
+  call assert
+  jmp .Lend.main.414
+.Lcall.main.414:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.414:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 100
+  mov rax, rbp
+  sub rax, 212
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 97
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 212
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 98
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 212
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 99
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 212
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 212
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 100
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 212
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 101
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 212
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 102
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 212
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 212
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.350
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.415
+  mov rax, 0
+  call assert
+  jmp .Lend.main.415
+.Lcall.main.415:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.415:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 102
+  mov rax, rbp
+  sub rax, 204
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 97
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 204
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 98
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 204
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 99
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 204
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 204
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 100
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 204
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 101
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 204
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 102
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 204
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 204
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.351
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.416
+  mov rax, 0
+  call assert
+  jmp .Lend.main.416
+.Lcall.main.416:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.416:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  mov rax, rbp
+  sub rax, 196
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 196
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 196
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 196
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 196
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.352
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.417
+  mov rax, 0
+  call assert
+  jmp .Lend.main.417
+.Lcall.main.417:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.417:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 16
+  mov rax, rbp
+  sub rax, 180
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 180
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 180
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 180
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  push 16
+  push offset .L.data.main.353
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.418
+  mov rax, 0
+  call assert
+  jmp .Lend.main.418
+.Lcall.main.418:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.418:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  mov rax, rbp
+  sub rax, 164
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 102
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 164
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 111
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 164
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 111
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 164
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], dil
+  push rdi
+  add rsp, 8
+  push 4
+  push offset .L.data.main.354
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.419
+  mov rax, 0
+  call assert
+  jmp .Lend.main.419
+.Lcall.main.419:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.419:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 160
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 160
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 160
+  push rax
+  pop rax
+  add rax, 8
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 160
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.355
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.420
+  mov rax, 0
+  call assert
+  jmp .Lend.main.420
+.Lcall.main.420:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.420:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  mov rax, rbp
+  sub rax, 148
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 148
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 148
+  push rax
+  pop rax
+  add rax, 8
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 148
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.356
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.421
+  mov rax, 0
+  call assert
+  jmp .Lend.main.421
+.Lcall.main.421:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.421:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 136
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 136
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 136
+  push rax
+  pop rax
+  add rax, 8
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 136
+  push rax
+  pop rax
+  add rax, 8
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.357
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.422
+  mov rax, 0
+  call assert
+  jmp .Lend.main.422
+.Lcall.main.422:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.422:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 124
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 124
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 124
+  push rax
+  pop rax
+  add rax, 8
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 124
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.358
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.423
+  mov rax, 0
+  call assert
+  jmp .Lend.main.423
+.Lcall.main.423:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.423:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  mov rax, rbp
+  sub rax, 112
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 112
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 112
+  push rax
+  pop rax
+  add rax, 8
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 112
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.359
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.424
+  mov rax, 0
+  call assert
+  jmp .Lend.main.424
+.Lcall.main.424:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.424:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  mov rax, rbp
+  sub rax, 100
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 100
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 100
+  push rax
+  pop rax
+  add rax, 8
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 100
+  push rax
+  pop rax
+  add rax, 8
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.360
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.425
+  mov rax, 0
+  call assert
+  jmp .Lend.main.425
+.Lcall.main.425:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.425:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 88
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 88
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 88
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 88
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 88
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.361
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.426
+  mov rax, 0
+  call assert
+  jmp .Lend.main.426
+.Lcall.main.426:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.426:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  mov rax, rbp
+  sub rax, 72
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 72
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 72
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 72
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 72
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.362
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.427
+  mov rax, 0
+  call assert
+  jmp .Lend.main.427
+.Lcall.main.427:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.427:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 56
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 56
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 56
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 56
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 56
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.363
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.428
+  mov rax, 0
+  call assert
+  jmp .Lend.main.428
+.Lcall.main.428:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.428:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  mov rax, rbp
+  sub rax, 40
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 40
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 40
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 40
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 40
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.364
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.429
+  mov rax, 0
+  call assert
+  jmp .Lend.main.429
+.Lcall.main.429:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.429:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  mov rax, rbp
+  sub rax, 24
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 24
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 24
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 24
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.365
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.430
+  mov rax, 0
+  call assert
+  jmp .Lend.main.430
+.Lcall.main.430:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.430:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  push offset g3
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.366
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.431
+  mov rax, 0
+  call assert
+  jmp .Lend.main.431
+.Lcall.main.431:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.431:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  push offset g4
+  pop rax
+  movsx rax, word ptr [rax]
+  push rax
+  push offset .L.data.main.367
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.432
+  mov rax, 0
+  call assert
+  jmp .Lend.main.432
+.Lcall.main.432:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.432:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 5
+  push offset g5
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.368
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.433
+  mov rax, 0
+  call assert
+  jmp .Lend.main.433
+.Lcall.main.433:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.433:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 6
+  push offset g6
+  pop rax
+  mov rax, [rax]
+  push rax
+  push offset .L.data.main.369
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.434
+  mov rax, 0
+  call assert
+  jmp .Lend.main.434
+.Lcall.main.434:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.434:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 5
+  push offset g7
+  pop rax
+  mov rax, [rax]
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.370
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.435
+  mov rax, 0
+  call assert
+  jmp .Lend.main.435
+.Lcall.main.435:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.435:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push offset g8
+  pop rax
+  mov rax, [rax]
+  push rax
+  push offset .L.data.main.371
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.436
+  mov rax, 0
+  call strcmp
+  jmp .Lend.main.436
+.Lcall.main.436:
+  sub rsp, 8
+  mov rax, 0
+  call strcmp
+  add rsp, 8
+.Lend.main.436:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  push offset .L.data.main.372
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.437
+  mov rax, 0
+  call assert
+  jmp .Lend.main.437
+.Lcall.main.437:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.437:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push offset g9
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.373
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.438
+  mov rax, 0
+  call assert
+  jmp .Lend.main.438
+.Lcall.main.438:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.438:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  push offset g9
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.374
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.439
+  mov rax, 0
+  call assert
+  jmp .Lend.main.439
+.Lcall.main.439:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.439:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  push offset g9
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.375
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.440
+  mov rax, 0
+  call assert
+  jmp .Lend.main.440
+.Lcall.main.440:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.440:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push offset g10
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push offset .L.data.main.376
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.441
+  mov rax, 0
+  call strcmp
+  jmp .Lend.main.441
+.Lcall.main.441:
+  sub rsp, 8
+  mov rax, 0
+  call strcmp
+  add rsp, 8
+.Lend.main.441:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  push offset .L.data.main.377
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.442
+  mov rax, 0
+  call assert
+  jmp .Lend.main.442
+.Lcall.main.442:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.442:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push offset g10
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push offset .L.data.main.378
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.443
+  mov rax, 0
+  call strcmp
+  jmp .Lend.main.443
+.Lcall.main.443:
+  sub rsp, 8
+  mov rax, 0
+  call strcmp
+  add rsp, 8
+.Lend.main.443:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  push offset .L.data.main.379
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.444
+  mov rax, 0
+  call assert
+  jmp .Lend.main.444
+.Lcall.main.444:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.444:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push offset g10
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.380
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.445
+  mov rax, 0
+  call assert
+  jmp .Lend.main.445
+.Lcall.main.445:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.445:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  push 16
+  push 8
+  pop rdi
+  pop rax
+  cqo
+  idiv rdi
+  push rax
+  push offset .L.data.main.381
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.446
+  mov rax, 0
+  call assert
+  jmp .Lend.main.446
+.Lcall.main.446:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.446:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  push offset g11
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.382
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.447
+  mov rax, 0
+  call assert
+  jmp .Lend.main.447
+.Lcall.main.447:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.447:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  push offset g11
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.383
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.448
+  mov rax, 0
+  call assert
+  jmp .Lend.main.448
+.Lcall.main.448:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.448:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  push offset g11
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.384
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.449
+  mov rax, 0
+  call assert
+  jmp .Lend.main.449
+.Lcall.main.449:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.449:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  push offset g11
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.385
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.450
+  mov rax, 0
+  call assert
+  jmp .Lend.main.450
+.Lcall.main.450:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.450:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  push offset g12
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.386
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.451
+  mov rax, 0
+  call assert
+  jmp .Lend.main.451
+.Lcall.main.451:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.451:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 2
+  push offset g12
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.387
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.452
+  mov rax, 0
+  call assert
+  jmp .Lend.main.452
+.Lcall.main.452:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.452:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 3
+  push offset g12
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.388
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.453
+  mov rax, 0
+  call assert
+  jmp .Lend.main.453
+.Lcall.main.453:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.453:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  push offset g12
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.389
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.454
+  mov rax, 0
+  call assert
+  jmp .Lend.main.454
+.Lcall.main.454:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.454:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  push 4
+  push offset .L.data.main.390
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.455
+  mov rax, 0
+  call assert
+  jmp .Lend.main.455
+.Lcall.main.455:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.455:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 99
+  push offset g13
+  push 2
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.391
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.456
+  mov rax, 0
+  call assert
+  jmp .Lend.main.456
+.Lcall.main.456:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.456:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push offset g13
+  push 3
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.392
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.457
+  mov rax, 0
+  call assert
+  jmp .Lend.main.457
+.Lcall.main.457:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.457:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 6
+  push 6
+  push offset .L.data.main.393
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.458
+  mov rax, 0
+  call assert
+  jmp .Lend.main.458
+.Lcall.main.458:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.458:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 34
+  push offset g14
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.394
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.459
+  mov rax, 0
+  call assert
+  jmp .Lend.main.459
+.Lcall.main.459:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.459:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push offset g14
+  push 5
+  pop rdi
+  pop rax
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx rax, byte ptr [rax]
+  push rax
+  push offset .L.data.main.395
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.460
+  mov rax, 0
+  call assert
+  jmp .Lend.main.460
+.Lcall.main.460:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.460:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 144
+  push 144
+  push offset .L.data.main.396
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.461
+  mov rax, 0
+  call assert
+  jmp .Lend.main.461
+.Lcall.main.461:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.461:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 1
+  push offset g15
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push offset .L.data.main.397
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.462
+  mov rax, 0
+  call assert
+  jmp .Lend.main.462
+.Lcall.main.462:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.462:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push offset g15
+  push 16
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push offset .L.data.main.398
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.463
+  mov rax, 0
+  call assert
+  jmp .Lend.main.463
+.Lcall.main.463:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.463:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  push offset g15
+  push 17
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push offset .L.data.main.399
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.464
+  mov rax, 0
+  call assert
+  jmp .Lend.main.464
+.Lcall.main.464:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.464:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  push offset g16
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  push offset .L.data.main.400
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.465
+  mov rax, 0
+  call strcpy
+  jmp .Lend.main.465
+.Lcall.main.465:
+  sub rsp, 8
+  mov rax, 0
+  call strcpy
+  add rsp, 8
+.Lend.main.465:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push offset g16
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  push offset .L.data.main.401
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.466
+  mov rax, 0
+  call strcmp
+  jmp .Lend.main.466
+.Lcall.main.466:
+  sub rsp, 8
+  mov rax, 0
+  call strcmp
+  add rsp, 8
+.Lend.main.466:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  push offset .L.data.main.402
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.467
+  mov rax, 0
+  call assert
+  jmp .Lend.main.467
+.Lcall.main.467:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.467:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 9
+  mov rax, rbp
+  sub rax, 8
+  push rax
+  push offset g17
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov [rax], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 8
+  push rax
+  pop rax
+  mov rax, [rax]
+  push rax
+  push 9
+  pop rdi
+  pop rax
+  mov [rax], edi
+  push rdi
+  add rsp, 8
+  push offset g17
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.403
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.468
+  mov rax, 0
+  call assert
+  jmp .Lend.main.468
+.Lcall.main.468:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.468:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 4
+  push offset g17
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  movsxd rax, dword ptr [rax]
+  push rax
+  push offset .L.data.main.404
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.469
+  mov rax, 0
+  call assert
+  jmp .Lend.main.469
+.Lcall.main.469:
+  sub rsp, 8
+  mov rax, 0
+  call assert
+  add rsp, 8
+.Lend.main.469:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push offset .L.data.main.405
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .Lcall.main.470
+  mov rax, 0
+  call printf
+  jmp .Lend.main.470
+.Lcall.main.470:
+  sub rsp, 8
+  mov rax, 0
+  call printf
+  add rsp, 8
+.Lend.main.470:
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  add rsp, 8
+  push 0
+  pop rax
+  jmp .Lreturn.main
+# epilogue
+.Lreturn.main:
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -2,23 +2,172 @@
 #include <ctype.h>
 #include "9cc.h"
 
-char *filename;
-char *user_input;
-Token *token;
-
-char *strndup(char *p, int len) {
-    char *buf = malloc(len + 1);
-    strncpy(buf, p, len);
-    buf[len] = '\0';
-    return buf;
+// 複数のファイルを別々のスレッドで同時にコンパイルできるよう、
+// コンパイル中の状態はすべてスレッドごとに持つ
+_Thread_local char *filename;
+_Thread_local char *user_input;
+_Thread_local Token *token;
+
+// トークンはパーサが必要としたときに1つずつ読み取る
+// 読み取ったトークンは window_head から始まる連結リストとして保持し、
+// トップレベルの宣言を読み終えるたびに、それより前のトークンを解放する
+static _Thread_local char *lex_pos;         // 次に読み取る位置
+static _Thread_local Token *window_head;    // まだ解放していない最も古いトークン
+static _Thread_local Token *free_tokens;    // 解放されて再利用を待っているトークン
+static _Thread_local int nmarks;            // mark_token で控えている位置の数
+
+// 予約語・記号の綴り
+typedef struct {
+    char *str;
+    int len;
+} Spelling;
+
+#define R(kind, s) [kind] = { s, sizeof(s) - 1 }
+static Spelling reserved_spelling[RESERVED_NUM] = {
+    R(KW_RETURN, "return"),
+    R(KW_IF, "if"),
+    R(KW_ELSE, "else"),
+    R(KW_WHILE, "while"),
+    R(KW_FOR, "for"),
+    R(KW_INT, "int"),
+    R(KW_CHAR, "char"),
+    R(KW_SIZEOF, "sizeof"),
+    R(KW_STRUCT, "struct"),
+    R(KW_TYPEDEF, "typedef"),
+    R(KW_SHORT, "short"),
+    R(KW_LONG, "long"),
+    R(KW_VOID, "void"),
+    R(KW_BOOL, "_Bool"),
+    R(KW_ENUM, "enum"),
+    R(KW_STATIC, "static"),
+    R(KW_BREAK, "break"),
+    R(KW_CONTINUE, "continue"),
+    R(KW_GOTO, "goto"),
+    R(KW_SWITCH, "switch"),
+    R(KW_CASE, "case"),
+    R(KW_DEFAULT, "default"),
+    R(PT_LPAREN, "("),
+    R(PT_RPAREN, ")"),
+    R(PT_LBRACE, "{"),
+    R(PT_RBRACE, "}"),
+    R(PT_LBRACKET, "["),
+    R(PT_RBRACKET, "]"),
+    R(PT_SEMICOLON, ";"),
+    R(PT_COMMA, ","),
+    R(PT_DOT, "."),
+    R(PT_ARROW, "->"),
+    R(PT_QUESTION, "?"),
+    R(PT_COLON, ":"),
+    R(PT_ASSIGN, "="),
+    R(PT_ADD_ASSIGN, "+="),
+    R(PT_SUB_ASSIGN, "-="),
+    R(PT_MUL_ASSIGN, "*="),
+    R(PT_DIV_ASSIGN, "/="),
+    R(PT_SHL_ASSIGN, "<<="),
+    R(PT_SHR_ASSIGN, ">>="),
+    R(PT_PLUS, "+"),
+    R(PT_MINUS, "-"),
+    R(PT_STAR, "*"),
+    R(PT_SLASH, "/"),
+    R(PT_AMP, "&"),
+    R(PT_PIPE, "|"),
+    R(PT_CARET, "^"),
+    R(PT_TILDE, "~"),
+    R(PT_NOT, "!"),
+    R(PT_SHL, "<<"),
+    R(PT_SHR, ">>"),
+    R(PT_EQ, "=="),
+    R(PT_NE, "!="),
+    R(PT_LT, "<"),
+    R(PT_LE, "<="),
+    R(PT_GT, ">"),
+    R(PT_GE, ">="),
+    R(PT_LOGAND, "&&"),
+    R(PT_LOGOR, "||"),
+    R(PT_INC, "++"),
+    R(PT_DEC, "--"),
+};
+#undef R
+
+// intern された識別子の表
+// 同じ綴りの識別子は1つの文字列を共有するので、名前の比較はポインタの比較でよい
+typedef struct {
+    char *name;
+    int len;
+    unsigned int hash;
+} InternEntry;
+
+static _Thread_local InternEntry *intern_table;
+static _Thread_local int intern_capacity;
+static _Thread_local int intern_used;
+
+static unsigned int hash_string(char *p, int len) {
+    // FNV-1a
+    unsigned int h = 2166136261u;
+    for (int i = 0; i < len; i++) {
+        h = (h ^ (unsigned char)p[i]) * 16777619u;
+    }
+    return h;
+}
+
+// 表を倍の大きさにして登録済みの文字列を入れ直す
+static void grow_intern_table() {
+    InternEntry *old = intern_table;
+    int old_capacity = intern_capacity;
+
+    intern_capacity = old_capacity ? old_capacity * 2 : 1024;
+    intern_table = calloc(intern_capacity, sizeof(InternEntry));
+
+    for (int i = 0; i < old_capacity; i++) {
+        if (!old[i].name) {
+            continue;
+        }
+        int j = old[i].hash & (intern_capacity - 1);
+        while (intern_table[j].name) {
+            j = (j + 1) & (intern_capacity - 1);
+        }
+        intern_table[j] = old[i];
+    }
+    free(old);
+}
+
+// intern した文字列はトークンの領域にあるので、領域を解放する前の入力の分は忘れる
+static void clear_intern_table() {
+    if (intern_table) {
+        memset(intern_table, 0, sizeof(InternEntry) * intern_capacity);
+    }
+    intern_used = 0;
+}
+
+// 長さ len の文字列 p を intern して、共有される文字列を返す
+char *intern(char *p, int len) {
+    // 使用率が 70% を超えたら表を広げる
+    if (intern_used * 10 >= intern_capacity * 7) {
+        grow_intern_table();
+    }
+
+    unsigned int hash = hash_string(p, len);
+    int i = hash & (intern_capacity - 1);
+    for (; intern_table[i].name; i = (i + 1) & (intern_capacity - 1)) {
+        InternEntry *e = &intern_table[i];
+        if (e->hash == hash && e->len == len && !memcmp(e->name, p, len)) {
+            return e->name;
+        }
+    }
+
+    InternEntry *e = &intern_table[i];
+    e->name = arena_strndup(p, len);
+    e->len = len;
+    e->hash = hash;
+    intern_used++;
+    return e->name;
 }
 
-// 先頭トークンが文字列 s とマッチしていれば真を返す
+// 先頭トークンが予約語・記号 kind であれば真を返す
 // トークンは進めない
-Token *peek(char *s) {
-    if (token->kind != TK_RESERVED ||
-        strlen(s) != token->len ||
-        memcmp(token->str, s, token->len)) {
+// 予約語・記号でないトークンの reserved は RESERVED_NONE なので、整数の比較1回で済む
+Token *peek(ReservedKind kind) {
+    if (token->reserved != kind) {
         return NULL;
     }
     return token;
@@ -26,12 +175,12 @@ Token *peek(char *s) {
 
 // 次のトークンが期待している記号と同じであればトークンを1つ読み進め真を返す
 // それ以外の場合は偽を返す
-Token *consume(char *s) {
-    if (!peek(s)) {
+Token *consume(ReservedKind kind) {
+    if (!peek(kind)) {
         return NULL;
     }
     Token *t = token;
-    token = token->next;
+    token = next_token(token);
     return t;
 }
 
@@ -42,17 +191,17 @@ Token *consume_ident() {
         return NULL;
     }
     Token *t = token;
-    token = token->next;
+    token = next_token(token);
     return t;
 }
 
 // 次のトークンが期待している文字列と同じであればトークンを1つ読み進める
 // それ以外の場合はエラーを報告する
-void expect(char *s) {
-    if (!peek(s)) {
-        error_tok(token, "expected \"%s\"", s);
+void expect(ReservedKind kind) {
+    if (!peek(kind)) {
+        error_tok(token, "expected \"%s\"", reserved_spelling[kind].str);
     }
-    token = token->next;
+    token = next_token(token);
 }
 
 // 次のトークンが数値の場合、トークンをひとつ読み進めてその数値を返す
@@ -62,18 +211,19 @@ long expect_number() {
         error_tok(token, "expected a number");
     }
     long val = token->val;
-    token = token->next;
+    token = next_token(token);
     return val;
 }
 
 // 次のトークンが識別子の場合、トークンをひとつ読み進めてその識別子を返す
+// 返す識別子は intern されている
 // それ以外の場合はエラーを報告する
 char *expect_ident() {
     if (token->kind != TK_IDENT) {
         error_tok(token, "expected an identifier");
     }
-    char *s = strndup(token->str, token->len);
-    token = token->next;
+    char *s = token->name;
+    token = next_token(token);
     return s;
 }
 
@@ -81,13 +231,90 @@ bool at_eof() {
     return token->kind == TK_EOF;
 }
 
-// 新しいトークンを作成して cur につなげる
-Token *new_token(TokenKind kind, Token *cur, char *str, int len) {
-    Token *tok = calloc(1, sizeof(Token));
+//
+// 行の表
+//
+
+// 各行の先頭の位置を、字句解析が進むのにあわせて記録しておく
+// 行番号は表を二分探索して求めるので、エラー表示のたびに入力の先頭から数え直さなくていい
+static _Thread_local char **line_starts;
+static _Thread_local int nlines;
+static _Thread_local int line_capacity;
+static _Thread_local char *line_scanned;    // 改行を探し終えた位置
+
+static void add_line(char *start) {
+    if (nlines == line_capacity) {
+        line_capacity = line_capacity ? line_capacity * 2 : 1024;
+        line_starts = realloc(line_starts, sizeof(char *) * line_capacity);
+    }
+    line_starts[nlines++] = start;
+}
+
+// p より前にある改行をすべて表に登録する
+static void scan_lines(char *p) {
+    char *q = line_scanned;
+    while (q < p) {
+        char *nl = memchr(q, '\n', p - q);
+        if (!nl) {
+            break;
+        }
+        add_line(nl + 1);
+        q = nl + 1;
+    }
+    if (line_scanned < p) {
+        line_scanned = p;
+    }
+}
+
+// loc がある行の行番号(1始まり)を返し、line_start に行の先頭を入れる
+int find_line(char *loc, char **line_start) {
+    scan_lines(loc);
+
+    // line_starts[i] <= loc となる最大の i を探す
+    int lo = 0;
+    int hi = nlines - 1;
+    while (lo < hi) {
+        int mid = (lo + hi + 1) / 2;
+        if (line_starts[mid] <= loc) {
+            lo = mid;
+        }
+        else {
+            hi = mid - 1;
+        }
+    }
+
+    if (line_start) {
+        *line_start = line_starts[lo];
+    }
+    return lo + 1;
+}
+
+static void init_lines() {
+    nlines = 0;
+    line_scanned = user_input;
+    add_line(user_input);
+}
+
+// 新しいトークンを作成する
+// 解放済みのトークンがあればそれを再利用する
+Token *new_token(TokenKind kind, char *str, int len) {
+    Token *tok = free_tokens;
+    if (tok) {
+        free_tokens = tok->next;
+        memset(tok, 0, sizeof(Token));
+    }
+    else {
+        tok = arena_alloc(ARENA_TOKEN, sizeof(Token));
+    }
     tok->kind = kind;
     tok->str = str;
     tok->len = len;
-    cur->next = tok;
+    stats.tokens++;
+
+    // トークンは先頭から順に作られるので、表の最後の行に入っている
+    scan_lines(str);
+    tok->line = nlines;
+    tok->col = str - line_starts[nlines - 1] + 1;
     return tok;
 }
 
@@ -95,74 +322,106 @@ bool is_alpha(char c) {
     return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || c == '_';
 }
 
-bool is_alnum(char c) {
-    return is_alpha(c) || ('0' <= c && c <= '9');
-}
-
-// 文字列 p の先頭が文字列 q と一致するかを判定
-bool startswith(char *p, char *q) {
-    return memcmp(p, q, strlen(q)) == 0;
-}
-
-// 文字列 p が予約語で始まるかを判定し、その文字列を返す
-char *starts_with_reserved(char *p) {
-    // Keywords
-    static char *kw[] = {
-        "return",
-        "if",
-        "else",
-        "while",
-        "for",
-        "int",
-        "char",
-        "sizeof",
-        "struct",
-        "typedef",
-        "short",
-        "long",
-        "void",
-        "_Bool",
-        "enum",
-        "static",
-        "break",
-        "continue",
-        "goto",
-        "switch",
-        "case",
-        "default",
-    };
-
-    for (int i=0; i < sizeof(kw) / sizeof(*kw); i++) {
-        int len = strlen(kw[i]);
-        // 予約語 "if" が、識別子 "iff" を誤認識しないように1文字先読み
-        if (startswith(p, kw[i]) && !is_alnum(p[len])) {
-            return kw[i];
-        }
+// 予約語の長さと先頭・末尾の文字から求めるハッシュ値
+// 今ある予約語どうしでは衝突しない係数を選んでいる
+// 予約語を追加するときは衝突しないことを確認すること
+#define KW_HASH(len, first, last) (((len) + (first) + (last) * 5) & 63)
+
+// ハッシュ値を添字とした予約語の表 (完全ハッシュ)
+// 添字はコンパイル時に計算されるので、実行時に表を作る必要はない
+#define KW(kind, s, first, last) [KW_HASH(sizeof(s) - 1, first, last)] = kind
+static ReservedKind kw_table[64] = {
+    KW(KW_RETURN, "return", 'r', 'n'),
+    KW(KW_IF, "if", 'i', 'f'),
+    KW(KW_ELSE, "else", 'e', 'e'),
+    KW(KW_WHILE, "while", 'w', 'e'),
+    KW(KW_FOR, "for", 'f', 'r'),
+    KW(KW_INT, "int", 'i', 't'),
+    KW(KW_CHAR, "char", 'c', 'r'),
+    KW(KW_SIZEOF, "sizeof", 's', 'f'),
+    KW(KW_STRUCT, "struct", 's', 't'),
+    KW(KW_TYPEDEF, "typedef", 't', 'f'),
+    KW(KW_SHORT, "short", 's', 't'),
+    KW(KW_LONG, "long", 'l', 'g'),
+    KW(KW_VOID, "void", 'v', 'd'),
+    KW(KW_BOOL, "_Bool", '_', 'l'),
+    KW(KW_ENUM, "enum", 'e', 'm'),
+    KW(KW_STATIC, "static", 's', 'c'),
+    KW(KW_BREAK, "break", 'b', 'k'),
+    KW(KW_CONTINUE, "continue", 'c', 'e'),
+    KW(KW_GOTO, "goto", 'g', 'o'),
+    KW(KW_SWITCH, "switch", 's', 'h'),
+    KW(KW_CASE, "case", 'c', 'e'),
+    KW(KW_DEFAULT, "default", 'd', 't'),
+};
+#undef KW
+
+// 長さ len の識別子 p が予約語であればその種類を返す
+// ハッシュ表を1回引いて、候補の予約語と比較するだけでよい
+ReservedKind find_keyword(char *p, int len) {
+    ReservedKind kind = kw_table[KW_HASH(len, p[0], p[len - 1])];
+    Spelling *sp = &reserved_spelling[kind];
+    if (kind && sp->len == len && !memcmp(p, sp->str, len)) {
+        return kind;
     }
-
-    return NULL;
+    return RESERVED_NONE;
 }
 
-// 文字列 p が演算子で始まるかを判定し、その文字列を返す
-char *starts_with_reserved_ops(char *p) {
-    // 先に長い演算子からマッチを試みる
-    static char *ops[] = {
-        "<<=", ">>=",
-        "==", "!=", "<=", ">=", "->", "++", "--",
-        "+=", "-=", "*=", "/=",
-        "&&", "||", "<<", ">>",
-        "+", "-", "*", "&", "/", "(", ")", "<", ">", ";", "=",
-        "{", "}", ",", "[", "]", ".", ",", "!", "~", "|", "^", ":", "?",
-    };
-
-    // Multi/single-letter punctuator
-    for (int i=0; i < sizeof(ops) / sizeof(*ops); i++) {
-        if (startswith(p, ops[i])) {
-            return ops[i];
+// 文字列 p が記号で始まるかを判定し、その種類を返す
+// 記号でなければ RESERVED_NONE を返す
+// 先頭の1文字で分岐してから、長い記号から順にマッチを試みる
+ReservedKind read_punct(char *p) {
+    switch (*p) {
+    case '<':
+        if (p[1] == '<') {
+            return p[2] == '=' ? PT_SHL_ASSIGN : PT_SHL;
+        }
+        return p[1] == '=' ? PT_LE : PT_LT;
+    case '>':
+        if (p[1] == '>') {
+            return p[2] == '=' ? PT_SHR_ASSIGN : PT_SHR;
+        }
+        return p[1] == '=' ? PT_GE : PT_GT;
+    case '=':
+        return p[1] == '=' ? PT_EQ : PT_ASSIGN;
+    case '!':
+        return p[1] == '=' ? PT_NE : PT_NOT;
+    case '*':
+        return p[1] == '=' ? PT_MUL_ASSIGN : PT_STAR;
+    case '/':
+        return p[1] == '=' ? PT_DIV_ASSIGN : PT_SLASH;
+    case '+':
+        if (p[1] == '+') {
+            return PT_INC;
+        }
+        return p[1] == '=' ? PT_ADD_ASSIGN : PT_PLUS;
+    case '-':
+        if (p[1] == '-') {
+            return PT_DEC;
+        }
+        if (p[1] == '>') {
+            return PT_ARROW;
         }
+        return p[1] == '=' ? PT_SUB_ASSIGN : PT_MINUS;
+    case '&':
+        return p[1] == '&' ? PT_LOGAND : PT_AMP;
+    case '|':
+        return p[1] == '|' ? PT_LOGOR : PT_PIPE;
+    case '(': return PT_LPAREN;
+    case ')': return PT_RPAREN;
+    case '{': return PT_LBRACE;
+    case '}': return PT_RBRACE;
+    case '[': return PT_LBRACKET;
+    case ']': return PT_RBRACKET;
+    case ';': return PT_SEMICOLON;
+    case ',': return PT_COMMA;
+    case '.': return PT_DOT;
+    case '~': return PT_TILDE;
+    case '^': return PT_CARET;
+    case ':': return PT_COLON;
+    case '?': return PT_QUESTION;
+    default:  return RESERVED_NONE;
     }
-
-    return NULL;
 }
 
 char get_escape_char(char c) {
@@ -181,42 +440,59 @@ char get_escape_char(char c) {
     }
 }
 
-Token *read_string_literal(Token *cur, char *start) {
+// 文字列リテラルを読み取る
+// 長さに上限はない
+// エスケープを含まないリテラルは、中身をコピーせずに入力を直接指す
+Token *read_string_literal(char *start) {
     char *p = start + 1;
-    char buf[1024];
-    int len = 0;
 
+    // 閉じるダブルクオートを探す
+    // エスケープがあれば、中身をコピーするバッファが必要になる
+    bool has_escape = false;
+    char *end = p;
     for (;;) {
-        if (len == sizeof(buf)) {
-            // 文字列リテラルは1024文字まで
-            error_at(start, "string literal too large");
+        end = scan.find_string_end(end);
+        if (*end == '"') {
+            break;
         }
-        if (*p == '\0') {
+        if (*end == '\0' || end[1] == '\0') {
             // ダブルクオートがないまま末尾に達した場合
             error_at(start, "unclosed string literal");
         }
-        if (*p == '"') {
-            break;
-        }
+        // バックスラッシュとエスケープされた文字を飛ばす
+        has_escape = true;
+        end += 2;
+    }
 
-        if (*p == '\\') {
-            p++;
-            buf[len++] = get_escape_char(*p++);
-        }
-        else {
-            buf[len++] = *p++;
+    Token *tok = new_token(TK_STR, start, end - start + 1);
+    if (!has_escape) {
+        tok->contents = p;
+        tok->cont_len = end - p + 1;
+        return tok;
+    }
+
+    // エスケープを解釈すると入力より短くなるので、入力の長さのバッファに収まる
+    char *buf = arena_alloc(ARENA_TOKEN, end - p);
+    int len = 0;
+    for (;;) {
+        // エスケープのない部分はまとめてコピーする
+        char *q = scan.find_string_end(p);
+        memcpy(buf + len, p, q - p);
+        len += q - p;
+        p = q;
+        if (p == end) {
+            break;
         }
+        buf[len++] = get_escape_char(p[1]);
+        p += 2;
     }
 
-    Token *tok = new_token(TK_STR, cur, start, p - start + 1);
-    tok->contents = malloc(len + 1);
-    memcpy(tok->contents, buf, len);
-    tok->contents[len] = '\0';
+    tok->contents = buf;
     tok->cont_len = len + 1;
     return tok;
 }
 
-Token *read_char_literal(Token *cur, char *start) {
+Token *read_char_literal(char *start) {
     // 最初の一文字はシングルクォートなので飛ばす
     char *p = start + 1;
     if (*p == '\0') {
@@ -237,95 +513,201 @@ Token *read_char_literal(Token *cur, char *start) {
     }
     p++;
 
-    Token *tok = new_token(TK_NUM, cur, start, p - start);
+    Token *tok = new_token(TK_NUM, start, p - start);
     tok->val = c;
     return tok;
 }
 
-// 入力文字列 p をトークナイズしてそれを返す
-Token *tokenize() {
-    char *p = user_input;
-    Token head;
-    head.next = NULL;
-    Token *cur = &head;
-
-    while (*p) {
-        if (isspace(*p)) {
-            p++;
-            continue;
-        }
+// 次のトークンを1つ読み取って返す
+// 入力の終わりに達したら TK_EOF のトークンを返す
+static Token *lex_token() {
+    char *p = lex_pos;
+
+    for (;;) {
+        // 空白やコメントの中身は scan の関数でまとめて読み飛ばす
+        p = scan.skip_space(p);
 
         // 空白と同様にコメントも読み飛ばす
-        if (startswith(p, "//")) {
-            p += 2;
-            while (*p != '\n') {
-                p++;
-            }
+        if (p[0] == '/' && p[1] == '/') {
+            p = scan.find_newline(p + 2);
             continue;
         }
 
-        if (startswith(p, "/*")) {
-            char *q = strstr(p + 2, "*/");
-            if (!q) {
-                error_at(p, "unclosed block comment");
+        if (p[0] == '/' && p[1] == '*') {
+            char *q = p + 2;
+            for (;;) {
+                q = scan.find_star(q);
+                if (!*q) {
+                    error_at(p, "unclosed block comment");
+                }
+                if (q[1] == '/') {
+                    break;
+                }
+                q++;
             }
             p = q + 2;
             continue;
         }
 
-        // Keyword
-        char *kw = starts_with_reserved(p);
+        break;
+    }
+
+    Token *tok;
+
+    if (!*p) {
+        tok = new_token(TK_EOF, p, 0);
+    }
+    // Identifier or keyword
+    else if (is_alpha(*p)) {
+        char *q = p;
+        p = scan.skip_ident(p + 1);
+        // 識別子を読み切ってから予約語かどうかを判定するので
+        // 予約語 "if" が識別子 "iff" を誤認識することはない
+        ReservedKind kw = find_keyword(q, p - q);
         if (kw) {
-            int len = strlen(kw);
-            cur = new_token(TK_RESERVED, cur, p, len);
-            p += len;
-            continue;
+            tok = new_token(TK_RESERVED, q, p - q);
+            tok->reserved = kw;
         }
-        
-        char *op = starts_with_reserved_ops(p);
-        if (op) {
-            int len = strlen(op);
-            cur = new_token(TK_RESERVED, cur, p, len);
-            p += len;
-            continue;
+        else {
+            tok = new_token(TK_IDENT, q, p - q);
+            tok->name = intern(q, p - q);
         }
-
-        // Identifier
-        if (isalpha(*p)) {
-            char *q = p++;
-            while (is_alnum(*p)) {
-                p++;
+    }
+    // String literal
+    else if (*p == '"') {
+        tok = read_string_literal(p);
+        p += tok->len;
+    }
+    // Character literal
+    else if (*p == '\'') {
+        tok = read_char_literal(p);
+        p += tok->len;
+    }
+    // Integer literal
+    else if (isdigit(*p)) {
+        char *q = p;
+        p = scan.skip_digits(p);
+        long val;
+        if (p - q <= 18) {
+            // 18 桁までなら long に収まるので、strtol を呼ばずに計算する
+            val = 0;
+            for (char *r = q; r < p; r++) {
+                val = val * 10 + (*r - '0');
             }
-            cur = new_token(TK_IDENT, cur, q, p - q);
-            continue;
         }
-
-        // String literal
-        if (*p == '"') {
-            cur = read_string_literal(cur, p);
-            p += cur->len;
-            continue;
+        else {
+            val = strtol(q, &p, 10);
         }
-
-        // Character literal
-        if (*p == '\'') {
-            cur = read_char_literal(cur, p);
-            p += cur->len;
-            continue;
+        tok = new_token(TK_NUM, q, p - q);
+        tok->val = val;
+    }
+    else {
+        // Multi/single-letter punctuator
+        ReservedKind punct = read_punct(p);
+        if (!punct) {
+            error_at(p, "invalid token");
         }
+        int len = reserved_spelling[punct].len;
+        tok = new_token(TK_RESERVED, p, len);
+        tok->reserved = punct;
+        p += len;
+    }
 
-        // Integer literal
-        if (isdigit(*p)) {
-            cur = new_token(TK_NUM, cur, p, 0);
-            char *q = p;
-            cur->val = strtol(p, &p, 10);
-            cur->len = p - q;
-            continue;
+    lex_pos = p;
+    return tok;
+}
+
+// tok の次のトークンを返す
+// トークンは必要になった時点で1つずつ読み取る
+Token *next_token(Token *tok) {
+    if (!tok->next && tok->kind != TK_EOF) {
+        if (stats.enabled) {
+            // 字句解析はパースの途中で行うので、時間はトークンごとに計って足し合わせる
+            double start = now();
+            tok->next = lex_token();
+            stats.phase_time[PHASE_TOKENIZE] += now() - start;
         }
+        else {
+            tok->next = lex_token();
+        }
+    }
+    return tok->next;
+}
 
-        error_at(p, "invalid token");
+// 今のトークンの位置を控える
+// 控えている間は、読み進めたトークンが解放されない
+Token *mark_token() {
+    nmarks++;
+    return token;
+}
+
+// mark_token で控えた位置までトークンを戻す
+void rewind_token(Token *mark) {
+    assert(nmarks > 0);
+    nmarks--;
+    token = mark;
+}
+
+// 控えた位置に戻らないことが確定したら呼ぶ
+void drop_mark() {
+    assert(nmarks > 0);
+    nmarks--;
+}
+
+// AST などから参照されるトークンに印をつけ、解放されないようにする
+Token *keep_token(Token *tok) {
+    if (tok) {
+        tok->is_kept = true;
+    }
+    return tok;
+}
+
+// 今のトークンより前のトークンを解放する
+// パーサがトップレベルの宣言を1つ読み終えるたびに呼ぶ
+// AST から参照されているトークンはそのまま残し、それ以外は再利用する
+void release_tokens() {
+    assert(nmarks == 0);
+
+    while (window_head != token) {
+        Token *tok = window_head;
+        window_head = tok->next;
+        tok->next = NULL;
+
+        if (!tok->is_kept) {
+            tok->next = free_tokens;
+            free_tokens = tok;
+        }
     }
+}
 
-    new_token(TK_EOF, cur, p, 0);
-    return head.next;
+// このスレッドのトークナイザが持っている表を解放する
+void release_tokenizer() {
+    free(intern_table);
+    intern_table = NULL;
+    intern_capacity = 0;
+    intern_used = 0;
+
+    free(line_starts);
+    line_starts = NULL;
+    nlines = 0;
+    line_capacity = 0;
+
+    free_tokens = NULL;
+    window_head = NULL;
+    token = NULL;
+}
+
+// 入力文字列 user_input のトークナイズを始め、最初のトークンを返す
+// 2つ目以降のトークンは next_token で読み進めたときに読み取る
+// 前の入力のトークンや intern した文字列は、トークンの領域ごと捨てられている前提で使わない
+// 呼び出し側が tokenize の間に arena_reset(ARENA_TOKEN) することがあるので、
+// 解放済みのトークンのリストと intern の表は、その領域を指したまま残さないよう必ずここで空にする
+Token *tokenize() {
+    lex_pos = user_input;
+    nmarks = 0;
+    free_tokens = NULL;
+    clear_intern_table();
+    init_lines();
+    window_head = lex_token();
+    return window_head;
 }
@@ -2,7 +2,8 @@
 #include "9cc.h"
 
 // 数値 n を、次の align の倍数に切り上げる
-int align_to(int n, int align) {
+// アリーナの確保のサイズにも使うので、int に収まらない大きさも扱えるよう size_t で計算する
+size_t align_to(size_t n, size_t align) {
     // e.g. align_to(10, 8) = (10 + 8 - 1) & ~(8 - 1)
     //                      = 17 & ~(7)
     //                      = 0b0001_0001 & ~0b0000_0111
@@ -12,71 +13,192 @@ int align_to(int n, int align) {
     return (n + align - 1) & ~(align - 1);
 }
 
-// 型情報を malloc して返す
+// 型情報をアリーナに確保して返す
+// サイズは、わかっていれば作った側が入れる
 Type *new_type(TypeKind kind, int align) {
-    Type *ty = calloc(1, sizeof(Type));
+    Type *ty = arena_alloc(ARENA_TYPE, sizeof(Type));
     ty->kind = kind;
     ty->align = align;
+    ty->size = -1;
+    stats.types++;
     return ty;
 }
 
+// 組み込みの型は書き換えることがないので、すべてのスレッドで1つずつを共有する
+static Type void_ty  = {TY_VOID, .align = 1, .size = -1};
+static Type bool_ty  = {TY_BOOL, .align = 1, .size = 1};
+static Type char_ty  = {TY_CHAR, .align = 1, .size = 1};
+static Type short_ty = {TY_SHORT, .align = 2, .size = 2};
+static Type int_ty   = {TY_INT, .align = 4, .size = 4};
+static Type long_ty  = {TY_LONG, .align = 8, .size = 8};
+static Type enum_ty  = {TY_ENUM, .align = 4, .size = 4};
+
 Type *void_type() {
-    return new_type(TY_VOID, 1);
+    return &void_ty;
 }
 
 Type *bool_type() {
-    return new_type(TY_BOOL, 1);
+    return &bool_ty;
 }
 
 Type *char_type() {
-    return new_type(TY_CHAR, 1);
+    return &char_ty;
 }
 
 Type *short_type() {
-    return new_type(TY_SHORT, 2);
+    return &short_ty;
 }
 
 Type *int_type() {
-    return new_type(TY_INT, 4);
+    return &int_ty;
 }
 
 Type *long_type() {
-    return new_type(TY_LONG, 8);
+    return &long_ty;
 }
 
 Type *enum_type() {
-    return new_type(TY_ENUM, 4);
+    return &enum_ty;
 }
 
+// 構造体型はメンバをあとから書き込むので、宣言ごとに作る
 Type *struct_type() {
     Type *ty = new_type(TY_STRUCT, 1);
     ty->is_incomplete = true;
     return ty;
 }
 
-Type *func_type(Type *return_ty) {
-    // todo: おそらく align は使わないから1にしている、関数ポインタとは別物
-    Type *ty = new_type(TY_FUNC, 1);
-    ty->return_ty = return_ty;
+// ポインタ型・配列型・関数型は、種類と元になる型と要素数が同じなら同じものを返す
+// 元になる型も同じものを共有しているので、キーはポインタの比較でよい
+// 型の領域はコンパイルのたびに解放されるので、表はコンパイルの最初に空にする
+static _Thread_local Type **type_table;
+static _Thread_local int type_capacity;
+static _Thread_local int type_used;
+
+static unsigned int hash_type(TypeKind kind, Type *base, int size) {
+    unsigned long h = (unsigned long)base >> 4;
+    h = (h ^ (h >> 17)) * 0x9e3779b97f4a7c15ul;
+    return (unsigned int)(h >> 32) ^ (kind * 31 + size) * 16777619u;
+}
+
+// 表を倍の大きさにして登録済みの型を入れ直す
+static void grow_type_table() {
+    Type **old = type_table;
+    int old_capacity = type_capacity;
+
+    type_capacity = old_capacity ? old_capacity * 2 : 256;
+    type_table = calloc(type_capacity, sizeof(Type *));
+
+    for (int i = 0; i < old_capacity; i++) {
+        Type *ty = old[i];
+        if (!ty) {
+            continue;
+        }
+        Type *base = ty->kind == TY_FUNC ? ty->return_ty : ty->base;
+        int j = hash_type(ty->kind, base, ty->array_size) & (type_capacity - 1);
+        while (type_table[j]) {
+            j = (j + 1) & (type_capacity - 1);
+        }
+        type_table[j] = ty;
+    }
+    free(old);
+}
+
+// 前のコンパイルで作った型を忘れる
+void reset_types() {
+    if (type_table) {
+        memset(type_table, 0, sizeof(Type *) * type_capacity);
+    }
+    type_used = 0;
+}
+
+// このスレッドの型の表を解放する
+void release_types() {
+    free(type_table);
+    type_table = NULL;
+    type_capacity = 0;
+    type_used = 0;
+}
+
+// kind 型の、base を元にした型を表から探し、なければ作って登録する
+// 関数型の場合、base は戻り値の型
+static Type *derived_type(TypeKind kind, Type *base, int size) {
+    // 使用率が 70% を超えたら表を広げる
+    if (type_used * 10 >= type_capacity * 7) {
+        grow_type_table();
+    }
+
+    int i = hash_type(kind, base, size) & (type_capacity - 1);
+    for (; type_table[i]; i = (i + 1) & (type_capacity - 1)) {
+        Type *ty = type_table[i];
+        if (ty->kind == kind && ty->array_size == size &&
+            (kind == TY_FUNC ? ty->return_ty : ty->base) == base) {
+            return ty;
+        }
+    }
+
+    Type *ty;
+    switch (kind) {
+    case TY_PTR:
+        ty = new_type(TY_PTR, 8);
+        ty->base = base;
+        ty->size = 8;
+        break;
+    case TY_ARRAY:
+        ty = new_type(TY_ARRAY, base->align);
+        ty->base = base;
+        ty->array_size = size;
+        // 要素のサイズがまだわからなければ、size_of で都度計算する
+        if (base->size >= 0) {
+            ty->size = base->size * size;
+        }
+        break;
+    default:
+        assert(kind == TY_FUNC);
+        // todo: おそらく align は使わないから1にしている、関数ポインタとは別物
+        ty = new_type(TY_FUNC, 1);
+        ty->return_ty = base;
+        break;
+    }
+
+    type_table[i] = ty;
+    type_used++;
     return ty;
 }
 
+Type *func_type(Type *return_ty) {
+    return derived_type(TY_FUNC, return_ty, 0);
+}
+
 // ベースの型情報を受取り、ポインタ型としてラップして返す
 Type *pointer_to(Type *base) {
-    Type *ty = new_type(TY_PTR, 8);
-    ty->base = base;
-    return ty;
+    return derived_type(TY_PTR, base, 0);
 }
 
 // ベースとなる型を配列型にラップする
 Type *array_of(Type *base, int size) {
+    return derived_type(TY_ARRAY, base, size);
+}
+
+// 要素数を省略した配列型を作る
+// 初期化子を読んだあとで要素数を書き込むので、共有せずに宣言ごとに作る
+Type *incomplete_array_of(Type *base) {
     Type *ty = new_type(TY_ARRAY, base->align);
     ty->base = base;
-    ty->array_size = size;
+    ty->is_incomplete = true;
     return ty;
 }
 
+// 要素数を省略した配列型に、初期化子からわかった要素数を入れる
+void complete_array(Type *ty, int size, Token *tok) {
+    assert(ty->kind == TY_ARRAY && ty->is_incomplete);
+    ty->array_size = size;
+    ty->is_incomplete = false;
+    ty->size = size_of(ty->base, tok) * size;
+}
+
 // 型から変数サイズを計算
+// ほとんどの型は作ったときにサイズが決まっているので、それを返す
 int size_of(Type *ty, Token *tok) {
     assert(ty->kind != TY_VOID);
 
@@ -84,39 +206,23 @@ int size_of(Type *ty, Token *tok) {
         error_tok(tok, "incomplete type");
     }
 
-    switch (ty->kind) {
-    case TY_BOOL:
-    case TY_CHAR:
-        return 1;
-    case TY_SHORT:
-        return 2;
-    case TY_INT:
-    case TY_ENUM:
-        return 4;
-    case TY_LONG:
-    case TY_PTR:
-        return 8;
-    case TY_ARRAY:
-        return size_of(ty->base, tok) * ty->array_size;
-    default:
-        assert(ty->kind == TY_STRUCT);
-        Member *mem = ty->members;
-        while (mem->next) {
-            mem = mem->next;
-        }
-        // 最後のメンバのオフセットに、最後のメンバのサイズを足す
-        int end = mem->offset + size_of(mem->ty, tok);
-        // 構造体自体の align には、メンバの中で最大の値が入っている
-        // 最後のメンバのあとにもパディングが入る可能性がある
-        return align_to(end, ty->align);
+    if (ty->size >= 0) {
+        return ty->size;
     }
+
+    // 作ったときに要素の型が incomplete だった配列は、ここで計算する
+    // e.g., struct S x[2]; の時点で struct S のメンバがまだ書かれていない場合や、
+    //       int (*x)[3] のプレースホルダを要素とする配列
+    assert(ty->kind == TY_ARRAY);
+    return size_of(ty->base, tok) * ty->array_size;
 }
 
 // 構造体型から指定された名前のメンバを探す
+// メンバ名も name も intern されているので、ポインタの比較でよい
 Member *find_member(Type *ty, char *name) {
     assert(ty->kind == TY_STRUCT);
     for (Member *mem = ty->members; mem; mem = mem->next) {
-        if (!strcmp(mem->name, name)) {
+        if (mem->name == name) {
             return mem;
         }
     }
@@ -129,20 +235,66 @@ void visit(Node *node) {
         return;
     }
 
-    // Node 構造体の全ての子要素を走査
-    visit(node->lhs);
-    visit(node->rhs);
-    visit(node->cond);
-    visit(node->then);
-    visit(node->els);
-    visit(node->init);
-    visit(node->inc);
-
-    for (Node *n = node->body; n; n = n->next) {
-        visit(n);
-    }
-    for (Node *n = node->args; n; n = n->next) {
-        visit(n);
+    // 子要素を走査する
+    // ノードは種類ごとに持っているフィールドが違うので、種類ごとに子をたどる
+    switch (node->kind) {
+    case ND_NUM:
+    case ND_VAR:
+    case ND_GOTO:
+    case ND_BREAK:
+    case ND_CONTINUE:
+    case ND_NULL:
+        break;
+    case ND_IF:
+    case ND_TERNARY:
+        visit(node_at(node->cond));
+        visit(node_at(node->then));
+        visit(node_at(node->els));
+        break;
+    case ND_WHILE:
+    case ND_SWITCH:
+        visit(node_at(node->cond));
+        visit(node_at(node->then));
+        break;
+    case ND_FOR:
+        visit(node_at(node->init));
+        visit(node_at(node->cond));
+        visit(node_at(node->inc));
+        visit(node_at(node->then));
+        break;
+    case ND_BLOCK:
+    case ND_STMT_EXPR:
+        for (Node *n = node_at(node->body); n; n = node_at(n->next)) {
+            visit(n);
+        }
+        break;
+    case ND_FUNCALL:
+        for (Node *n = node_at(node->args); n; n = node_at(n->next)) {
+            visit(n);
+        }
+        break;
+    case ND_PRE_INC:
+    case ND_PRE_DEC:
+    case ND_POST_INC:
+    case ND_POST_DEC:
+    case ND_ADDR:
+    case ND_DEREF:
+    case ND_NOT:
+    case ND_BITNOT:
+    case ND_RETURN:
+    case ND_SIZEOF:
+    case ND_EXPR_STMT:
+    case ND_CAST:
+    case ND_MEMBER:
+    case ND_LABEL:
+    case ND_CASE:
+        visit(node_at(node->lhs));
+        break;
+    default:
+        // 二項演算子
+        visit(node_at(node->lhs));
+        visit(node_at(node->rhs));
+        break;
     }
 
     // 型をつける
@@ -177,25 +329,25 @@ void visit(Node *node) {
         // 足し算の右側がポインタ・配列だった場合は左右を入れ替える
         // つまり x + &y; => &y + x
         // base が NULL でないということは、配列かポインタのいずれかである
-        if (node->rhs->ty->base) {
-            Node *tmp = node->lhs;
+        if (node_at(node->rhs)->ty->base) {
+            NodeId tmp = node->lhs;
             node->lhs = node->rhs;
             node->rhs = tmp;
         }
         // 入れ替えても右側がポインタ・配列の場合、
         // つまりポインタ同士の加算となるためエラーとする
-        if (node->rhs->ty->base) {
+        if (node_at(node->rhs)->ty->base) {
             error_tok(node->tok, "invalid pointer arithmetic operands");
         }
         // 足し算の式全体の型は、左手側の型と同じ
-        node->ty = node->lhs->ty;
+        node->ty = node_at(node->lhs)->ty;
         return;
     case ND_SUB:
         // 足し算と同じだが、左右の入れ替えはできないので簡易化
-        if (node->rhs->ty->base) {
+        if (node_at(node->rhs)->ty->base) {
             error_tok(node->tok, "invalid pointer arithmetic operands");
         }
-        node->ty = node->lhs->ty;
+        node->ty = node_at(node->lhs)->ty;
         return;
     case ND_ASSIGN:
     case ND_SHL:
@@ -214,65 +366,65 @@ void visit(Node *node) {
         // たとえば (x += y) の型は x の型と同じ
     case ND_BITNOT:
         // ビット反転した結果は、元々の型と同じ
-        node->ty = node->lhs->ty;
+        node->ty = node_at(node->lhs)->ty;
         return;
     case ND_TERNARY:
-        node->ty = node->then->ty;
+        node->ty = node_at(node->then)->ty;
         return;
     case ND_COMMA:
         // コンマでつながっている場合は右側の式の型が全体の型になる
-        node->ty = node->rhs->ty;
+        node->ty = node_at(node->rhs)->ty;
         return;
     case ND_MEMBER: {
         // 構造体のメンバアクセスのノードの型をつける
         // 構造体以外のノードにメンバアクセスしようとしていたらエラー
-        if (node->lhs->ty->kind != TY_STRUCT) {
+        if (node_at(node->lhs)->ty->kind != TY_STRUCT) {
             error_tok(node->tok, "not a struct");
         }
         // アクセスするメンバの型がこのノードの型になる
-        node->member = find_member(node->lhs->ty, node->member_name);
+        node->member = find_member(node_at(node->lhs)->ty, node->member_name);
         node->ty = node->member->ty;
         return;
     }
     case ND_ADDR:
-        if (node->lhs->ty->kind == TY_ARRAY) {
+        if (node_at(node->lhs)->ty->kind == TY_ARRAY) {
             // 配列変数への & は、配列の中身の型へのポインタ型になる
             // int x[2] のとき int *y = x; int *y = &x; の y は同じ
             // つまり x と &x は同じ値である
             // 一方で型は配列からポインタへ変わる
-            node->ty = pointer_to(node->lhs->ty->base);
+            node->ty = pointer_to(node_at(node->lhs)->ty->base);
         }
         else {
             // 左辺が配列でない場合は、
             // ポインタ変数への & は、ポインタをひとつネストする
             // int なら int* になるし、int* なら int** になる
-            node->ty = pointer_to(node->lhs->ty);
+            node->ty = pointer_to(node_at(node->lhs)->ty);
         }
         return;
     case ND_DEREF:
         // デリファレンスの場合はポインタ型のネストを1つ削除する
-        if (!node->lhs->ty->base) {
+        if (!node_at(node->lhs)->ty->base) {
             error_tok(node->tok, "invalid pointer dereference");
         }
-        node->ty = node->lhs->ty->base;
+        node->ty = node_at(node->lhs)->ty->base;
         if (node->ty->kind == TY_VOID) {
             error_tok(node->tok, "dereferencing a void pointer");
         }
         return;
     case ND_SIZEOF:
         // sizeof の値の計算はコンパイル時に終わり、AST には sizeof は残らない
+        // 型から値を計算
+        // val は lhs と同じ場所にあるので、lhs を読み終えてから書き込む
+        long val = size_of(node_at(node->lhs)->ty, node->tok);
         node->kind = ND_NUM;
         node->ty = int_type();
-        // 型から値を計算
-        node->val = size_of(node->lhs->ty, node->tok);
-        // sizeof 演算子の項では値の情報そのものは不要なので削除
-        node->lhs = NULL;
+        node->val = val;
         return;
     case ND_STMT_EXPR:
         // 最後の文の型がブロック全体の型になる
-        Node *last = node->body;
+        Node *last = node_at(node->body);
         while (last->next) {
-            last = last->next;
+            last = node_at(last->next);
         }
         node->ty = last->ty;
         return;
@@ -281,7 +433,11 @@ void visit(Node *node) {
 
 void add_type(Program *prog) {
     for (Function *fn = prog->fns; fn; fn = fn->next) {
-        for (Node *node = fn->node; node; node = node->next) {
+        if (fn->cached) {
+            continue;
+        }
+        node_base = fn->nodes;
+        for (Node *node = node_at(fn->node); node; node = node_at(node->next)) {
             visit(node);
         }
     }
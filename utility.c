@@ -3,6 +3,8 @@
 
 void print_node(Node *node, int depth);
 
+char *node_kind_name(NodeKind kind);
+
 static char *node_names[] = {
     "ADD",
     "SUB",
@@ -58,6 +60,10 @@ static char *node_names[] = {
     "NULL",
 };
 
+char *node_kind_name(NodeKind kind) {
+    return node_names[kind];
+}
+
 void print_escaped_char(char c) {
     switch (c) {
     case '\a':
@@ -94,14 +100,24 @@ void print_escaped_char(char c) {
 }
 
 void print_initializer_as_string(Initializer *init) {
-    for (; init; init = init->next) {
-        print_escaped_char((char)init->val);
+    for (int i = 0; i < init->size; i++) {
+        print_escaped_char(i < init->len ? init->data[i] : 0);
+    }
+}
+
+// 初期値の offset バイト目からの sz バイトの値
+static long initializer_value(Initializer *init, int offset, int sz) {
+    unsigned long val = 0;
+    for (int i = sz - 1; i >= 0; i--) {
+        int pos = offset + i;
+        val = val << 8 | (unsigned char)(pos < init->len ? init->data[pos] : 0);
     }
+    return val;
 }
 
-void print_initializer_array(Initializer *init) {
-    for (; init; init = init->next) {
-        fprintf(stderr, "%ld, ", init->val);
+void print_initializer_array(Initializer *init, int sz) {
+    for (int offset = 0; offset < init->size; offset += sz) {
+        fprintf(stderr, "%ld, ", initializer_value(init, offset, sz));
     }
 }
 
@@ -163,8 +179,8 @@ void print_binary_node(Node *node, int depth) {
     fprintf(stderr, "%*s%s : ", depth, " ", node_names[node->kind]);
     print_type(node->ty);
     fprintf(stderr, " = [\n");
-    print_node(node->lhs, depth + 2);
-    print_node(node->rhs, depth + 2);
+    print_node(node_at(node->lhs), depth + 2);
+    print_node(node_at(node->rhs), depth + 2);
     fprintf(stderr, "%*s]\n", depth, " ");
 }
 
@@ -172,7 +188,7 @@ void print_unary_node(Node *node, int depth) {
     fprintf(stderr, "%*s%s : ", depth, " ", node_names[node->kind]);
     print_type(node->ty);
     fprintf(stderr, "\n");
-    print_node(node->lhs, depth + 2);
+    print_node(node_at(node->lhs), depth + 2);
 }
 
 void print_node(Node *node, int depth) {
@@ -230,55 +246,55 @@ void print_node(Node *node, int depth) {
             break;
         case ND_MEMBER:
             fprintf(stderr, "%*sMEMBER %s : [\n", depth, " ", node->member_name);
-            print_node(node->lhs, depth + 2);
+            print_node(node_at(node->lhs), depth + 2);
             fprintf(stderr, "%*s]\n", depth, " ");
             break;
         case ND_TERNARY:
             fprintf(stderr, "%*sTERNARY [\n", depth, " ");
             fprintf(stderr, "%*sCOND\n", depth + 2, " ");
-            print_node(node->cond, depth + 4);
+            print_node(node_at(node->cond), depth + 4);
             fprintf(stderr, "%*sTHEN\n", depth + 2, " ");
-            print_node(node->then, depth + 4);
+            print_node(node_at(node->then), depth + 4);
             fprintf(stderr, "%*sELSE\n", depth + 2, " ");
-            print_node(node->els, depth + 4);
+            print_node(node_at(node->els), depth + 4);
             fprintf(stderr, "%*s]\n", depth, " ");
             break;
         case ND_IF:
             fprintf(stderr, "%*sIF [\n", depth, " ");
             fprintf(stderr, "%*sCOND\n", depth + 2, " ");
-            print_node(node->cond, depth + 4);
+            print_node(node_at(node->cond), depth + 4);
             fprintf(stderr, "%*sTHEN\n", depth + 2, " ");
-            print_node(node->then, depth + 4);
+            print_node(node_at(node->then), depth + 4);
             if (node->els) {
                 fprintf(stderr, "%*sELSE\n", depth + 2, " ");
-                print_node(node->els, depth + 4);
+                print_node(node_at(node->els), depth + 4);
             }
             fprintf(stderr, "%*s]\n", depth, " ");
             break;
         case ND_WHILE:
             fprintf(stderr, "%*sWHILE [\n", depth, " ");
             fprintf(stderr, "%*sCOND\n", depth + 2, " ");
-            print_node(node->cond, depth + 4);
+            print_node(node_at(node->cond), depth + 4);
             fprintf(stderr, "%*sBODY\n", depth + 2, " ");
-            print_node(node->then, depth + 4);
+            print_node(node_at(node->then), depth + 4);
             fprintf(stderr, "%*s]\n", depth, " ");
             break;
         case ND_FOR:
             fprintf(stderr, "%*sFOR [\n", depth, " ");
             if (node->init) {
                 fprintf(stderr, "%*sINIT\n", depth + 2, " ");
-                print_node(node->init, depth + 4);
+                print_node(node_at(node->init), depth + 4);
             }
             if (node->cond) {
                 fprintf(stderr, "%*sCOND\n", depth + 2, " ");
-                print_node(node->cond, depth + 4);
+                print_node(node_at(node->cond), depth + 4);
             }
             if (node->inc) {
                 fprintf(stderr, "%*sINC\n", depth + 2, " ");
-                print_node(node->inc, depth + 4);
+                print_node(node_at(node->inc), depth + 4);
             }
             fprintf(stderr, "%*sBODY\n", depth + 2, " ");
-            print_node(node->then, depth + 4);
+            print_node(node_at(node->then), depth + 4);
             fprintf(stderr, "%*s]\n", depth, " ");
             break;
         case ND_BREAK:
@@ -293,31 +309,31 @@ void print_node(Node *node, int depth) {
         case ND_SWITCH:
             fprintf(stderr, "%*sSWITCH [\n", depth, " ");
             fprintf(stderr, "%*sCOND\n", depth + 2, " ");
-            print_node(node->cond, depth + 4);
+            print_node(node_at(node->cond), depth + 4);
             fprintf(stderr, "%*sBODY\n", depth + 2, " ");
-            print_node(node->then, depth + 4);
+            print_node(node_at(node->then), depth + 4);
             fprintf(stderr, "%*s]\n", depth, " ");
             break;
         case ND_CASE:
-            fprintf(stderr, "%*sCASE %ld [\n", depth, " ", node->val);
-            print_node(node->lhs, depth + 2);
+            fprintf(stderr, "%*sCASE %ld [\n", depth, " ", node->case_val);
+            print_node(node_at(node->lhs), depth + 2);
             fprintf(stderr, "%*s]\n", depth, " ");
             break;
         case ND_BLOCK:
             fprintf(stderr, "%*sBLOCK [\n", depth, " ");
-            for (Node *n = node->body; n; n = n->next) {
+            for (Node *n = node_at(node->body); n; n = node_at(n->next)) {
                 print_node(n, depth + 2);
             }
             fprintf(stderr, "%*s]\n", depth, " ");
             break;
         case ND_LABEL:
             fprintf(stderr, "%*sLABEL %s [\n", depth, " ", node->label_name);
-            print_node(node->lhs, depth + 2);
+            print_node(node_at(node->lhs), depth + 2);
             fprintf(stderr, "%*s]\n", depth, " ");
             break;
         case ND_STMT_EXPR:
             fprintf(stderr, "%*sSTMT_EXPR [\n", depth, " ");
-            for (Node *n = node->body; n; n = n->next) {
+            for (Node *n = node_at(node->body); n; n = node_at(n->next)) {
                 print_node(n, depth + 2);
             }
             fprintf(stderr, "%*s]\n", depth, " ");
@@ -326,7 +342,7 @@ void print_node(Node *node, int depth) {
             fprintf(stderr, "%*sFUNCALL %s : ", depth, " ", node->funcname);
             print_type(node->ty);
             fprintf(stderr, " [\n");
-            for (Node *arg = node->args; arg; arg = arg->next) {
+            for (Node *arg = node_at(node->args); arg; arg = node_at(arg->next)) {
                 print_node(arg, depth + 2);
             }
             fprintf(stderr, "%*s]\n", depth, " ");
@@ -364,7 +380,8 @@ void print_functions(Function *fn) {
             print_type(vl->var->ty);
         }
         fprintf(stderr, ") {\n");
-        for (Node *node = fn->node; node; node = node->next) {
+        node_base = fn->nodes;
+        for (Node *node = node_at(fn->node); node; node = node_at(node->next)) {
             print_node(node, 2);
         }
         fprintf(stderr, "}\n");
@@ -385,16 +402,17 @@ void print_global_variables(VarList *vl) {
                 }
                 else {
                     fprintf(stderr, " = {");
-                    print_initializer_array(vl->var->initializer);
+                    print_initializer_array(vl->var->initializer, size_of(vl->var->ty->base, vl->var->tok));
                     fprintf(stderr, "}");
                 }
             }
             else {
-                if (vl->var->initializer->label) {
-                    fprintf(stderr, " = %s", vl->var->initializer->label);
+                Initializer *init = vl->var->initializer;
+                if (init->rels) {
+                    fprintf(stderr, " = %s", init->rels->var->name);
                 }
                 else {
-                    fprintf(stderr, " = %ld", vl->var->initializer->val);
+                    fprintf(stderr, " = %ld", initializer_value(init, 0, init->size));
                 }
             }
         }
@@ -412,7 +430,7 @@ void print_ast(Program *prog) {
 }
 
 // verror_at と同じ実装
-static Token *previous_token;
+static _Thread_local Token *previous_token;
 void print_source_code(Token *tok) {
     if (!tok) {
         return;
@@ -423,27 +441,20 @@ void print_source_code(Token *tok) {
     }
     previous_token = tok;
 
-    char *line = tok->str;
-    while (user_input < line && line[-1] != '\n') {
-        line--;
-    }
+    // 行番号と行頭の位置はトークンが持っている
+    int line_num = tok->line;
+    char *line = tok->str - (tok->col - 1);
 
     char *end = tok->str;
     while (*end != '\n') {
         end++;
     }
 
-    int line_num = 1;
-    for (char *p = user_input; p < line; p++) {
-        if (*p == '\n') {
-            line_num++;
-        }
-    }
-
-    printf("# ");
-    int indent = printf("%s:%d: ", filename, line_num);
-    printf("%.*s\n", (int)(end - line), line);
+    // アセンブリのコメントとして出力する
+    char header[256];
+    int indent = snprintf(header, sizeof(header), "%s:%d: ", filename, line_num);
+    emitf("# %s%.*s\n", header, (int)(end - line), line);
 
     int pos = tok->str - line + indent;
-    printf("# %*s^\n", pos, "");
+    emitf("# %*s^\n", pos, "");
 }
@@ -5,5 +5,6 @@
 
 void print_ast(Program *prog);
 void print_source_code(Token *tok);
+char *node_kind_name(NodeKind kind);
 
 #endif